@@ -98,6 +98,14 @@ static bool zb_apsde_data_indication_handler(const ezb_apsde_data_ind_t *ind)
     return false;
 }
 
+static ezb_aps_dispatch_handler_t s_dump_handler = {
+    .profile_id = EZB_APS_DISPATCH_ANY_PROFILE,
+    .cluster_id = EZB_APS_DISPATCH_ANY_CLUSTER,
+    .endpoint = EZB_APS_DISPATCH_ANY_ENDPOINT,
+    .priority = UINT8_MAX,
+    .callback = zb_apsde_data_indication_handler,
+};
+
 static ezb_err_t cli_aps_send_raw(esp_zb_cli_cmd_t *self, int argc, char **argv)
 {
     struct {
@@ -181,10 +189,11 @@ static ezb_err_t cli_aps_dump(esp_zb_cli_cmd_t *self, int argc, char **argv)
     int nerrors = arg_parse(argc, argv, (void**)&argtable);
     EXIT_ON_FALSE(nerrors == 0, EZB_ERR_INV_ARG, arg_print_errors(stdout, argtable.end, argv[0]));
 
+    /* Dump through the dispatch table, the indication handler of the application stays in place. */
     if (!strcmp(argtable.flag->sval[0], "open")) {
-        ezb_apsde_data_indication_handler_register(zb_apsde_data_indication_handler);
+        ezb_aps_dispatch_register(&s_dump_handler);
     } else if (!strcmp(argtable.flag->sval[0], "close")) {
-        ezb_apsde_data_indication_handler_register(NULL);
+        ezb_aps_dispatch_unregister(&s_dump_handler);
     } else {
         EXIT_ON_ERROR(EZB_ERR_INV_ARG, cli_output_line("invalid arg for dump"));
     }
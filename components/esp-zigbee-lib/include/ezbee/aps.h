@@ -275,4 +275,16 @@ void ezb_aps_get_use_extended_panid(ezb_extpanid_t *extpanid);
 } /*  extern "C" */
 #endif
 
+#include <ezbee/aps/aps_indirect_queue.h>
+#include <ezbee/aps/aps_stats.h>
+#include <ezbee/aps/aps_duty_cycle.h>
+#include <ezbee/aps/aps_fragment.h>
+#include <ezbee/aps/aps_buffer.h>
+#include <ezbee/aps/aps_aggregation.h>
+#include <ezbee/aps/aps_dup.h>
+#include <ezbee/aps/aps_rtt.h>
+#include <ezbee/aps/aps_binding.h>
+#include <ezbee/aps/aps_dispatch.h>
+#include <ezbee/aps/aps_tx_queue.h>
+
 #endif /* ESP_ZIGBEE_APS_H */
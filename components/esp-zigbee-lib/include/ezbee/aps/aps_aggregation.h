@@ -0,0 +1,136 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_APS_AGGREGATION_H
+#define ESP_ZIGBEE_APS_AGGREGATION_H
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the APS aggregation
+ *
+ * The unicast requests of the profile @p profile_id and of the enabled clusters, see
+ * @ref ezb_aps_aggregation_enable_cluster, are held for up to @p hold_time and packed with the following requests of
+ * the same destination, endpoints and transmit options into a single request of the container cluster
+ * @p cluster_id, of up to @p max_length bytes. The container is sent as soon as the next request does not fit in it.
+ *
+ * A received container of the profile @p profile_id is unpacked into one APSDE-DATA.indication per ASDU, passed to
+ * the application indication handler, see @ref ezb_apsde_data_indication_handler_register. The unpacked ASDUs do not
+ * reach the ZCL processing of the stack, so only the clusters whose frames the application handles from the APS
+ * indications should be enabled, typically manufacturer specific clusters. A container holding an ASDU of a cluster
+ * that is not enabled on the receiver is discarded as malformed, so both sides must enable the same clusters.
+ *
+ * Only the requests submitted with @ref ezb_aps_aggregation_data_request are aggregated. The ZCL commands sent with
+ * the ZCL request APIs and the frames the stack sends on its own, such as the attribute reports, bypass the
+ * aggregation. A manufacturer specific ZCL producer serializes the ZCL frame, header included, into the ASDU of its
+ * request instead.
+ *
+ * A held request has no confirm of its own: the confirm handler, see @ref ezb_apsde_data_confirm_handler_register,
+ * receives a single APSDE-DATA.confirm for the whole container, with the container cluster @p cluster_id. When the
+ * stack rejects a container, its ASDUs are dropped and counted in the @p tx_dropped statistic, see
+ * @ref ezb_aps_aggregation_get_stats. The requests that need an end-to-end result per ASDU should not be aggregated.
+ *
+ * The container ASDU holds a version byte, 0, followed by a record per ASDU: the cluster identifier (2 bytes, little
+ * endian), the length of the ASDU (1 byte) and the ASDU.
+ *
+ * @note The container cluster must be a manufacturer specific cluster identifier, from 0xfc00 to 0xffff. The
+ *       container cluster and profile must be the same on both sides. The container is not fragmented,
+ *       @p max_length must fit in a single frame.
+ */
+typedef struct ezb_aps_aggregation_config_s {
+    uint16_t profile_id;   /*!< The profile of the aggregated requests and of the containers, not the ZDP profile. */
+    uint16_t cluster_id;   /*!< The cluster identifier of the containers. */
+    uint16_t hold_time;    /*!< The maximum time a request is held, in milliseconds. */
+    uint8_t  max_length;   /*!< The maximum length of a container ASDU, in bytes. */
+    uint8_t  max_pending;  /*!< The maximum number of containers being filled at the same time. */
+    uint8_t  max_clusters; /*!< The maximum number of clusters enabled for aggregation. */
+} ezb_aps_aggregation_config_t;
+
+/**
+ * @brief Statistics of the APS aggregation
+ */
+typedef struct ezb_aps_aggregation_stats_s {
+    uint32_t tx_asdus;      /*!< Number of ASDUs sent packed into containers. */
+    uint32_t tx_containers; /*!< Number of containers sent, tx_asdus - tx_containers frames have been saved. */
+    uint32_t tx_failures;   /*!< Number of containers rejected by the stack. */
+    uint32_t tx_dropped;    /*!< Number of held ASDUs dropped because their container was rejected by the stack. */
+    uint32_t rx_containers; /*!< Number of containers received. */
+    uint32_t rx_asdus;      /*!< Number of ASDUs unpacked from the received containers. */
+    uint32_t rx_malformed;  /*!< Number of received containers discarded as malformed, or holding an ASDU of a
+                                 cluster that is not enabled. */
+} ezb_aps_aggregation_stats_t;
+
+/**
+ * @brief Initialize the APS aggregation.
+ *
+ * @param[in] config The configuration, @ref ezb_aps_aggregation_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The aggregation is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_aps_aggregation_init(const ezb_aps_aggregation_config_t *config);
+
+/**
+ * @brief Deinitialize the APS aggregation, the containers being filled are sent first.
+ */
+void ezb_aps_aggregation_deinit(void);
+
+/**
+ * @brief Enable or disable the aggregation of the requests of a cluster.
+ *
+ * @param[in] cluster_id The cluster identifier.
+ * @param[in] enable     Whether the requests of the cluster are aggregated.
+ *
+ * @note The enabled clusters are also the clusters accepted in the received containers.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: @p cluster_id is the container cluster
+ *      - EZB_ERR_INV_STATE: The aggregation is not initialized
+ *      - EZB_ERR_NO_MEM: The maximum number of clusters is reached
+ */
+ezb_err_t ezb_aps_aggregation_enable_cluster(uint16_t cluster_id, bool enable);
+
+/**
+ * @brief Submit an APSDE-DATA request through the aggregation.
+ *
+ * The request is held and packed when its profile is the configured one, its cluster is enabled and it is a unicast
+ * request without fragmentation nor alias, otherwise it is passed to @ref ezb_apsde_data_request directly. The ASDU is copied.
+ *
+ * @note EZB_ERR_NONE for a held request only means that it has been packed, the request is sent later and a
+ *       rejection by the stack is then reported in the statistics only, see @ref ezb_aps_aggregation_config_s.
+ *
+ * @param[in] req The request, @ref ezb_apsde_data_req_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success, the request is sent or held
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_INV_STATE: The aggregation is not initialized
+ *      - Other error codes of @ref ezb_apsde_data_request
+ */
+ezb_err_t ezb_aps_aggregation_data_request(const ezb_apsde_data_req_t *req);
+
+/**
+ * @brief Get the statistics of the APS aggregation.
+ *
+ * @param[out] stats The statistics, @ref ezb_aps_aggregation_stats_s
+ */
+void ezb_aps_aggregation_get_stats(ezb_aps_aggregation_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_APS_AGGREGATION_H */
@@ -0,0 +1,163 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_APS_BINDING_H
+#define ESP_ZIGBEE_APS_BINDING_H
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief An entry of the indexed binding table
+ */
+typedef struct ezb_aps_binding_s {
+    uint8_t src_endpoint;      /*!< The source endpoint. */
+    uint16_t cluster_id;       /*!< The cluster identifier. */
+    ezb_address_t dst_address; /*!< The destination, a group address or an extended address. */
+    uint8_t dst_endpoint;      /*!< The destination endpoint, ignored for a group address. */
+} ezb_aps_binding_t;
+
+/**
+ * @brief Configuration of the indexed binding table
+ *
+ * The table holds up to @p src_size distinct source endpoint and cluster pairs, kept sorted, and up to @p dst_size
+ * destinations, linked per pair. The destinations of a pair are found with a binary search on the pairs followed by
+ * a walk of its destinations only, independently of the other bindings. The sizes are usually those of the binding
+ * table of the stack, see @p aps_bind_table_src_size and @p aps_bind_table_dst_size of @ref ezb_mem_config_s.
+ *
+ * The table serves the fan-out issued by the application, see @ref ezb_aps_binding_data_request and
+ * @ref ezb_aps_binding_get_next. It is a copy of the binding table of the stack: the requests the stack sends to the
+ * bindings by itself, e.g. the attribute reports, still walk its own table.
+ *
+ * When @p mirror_zdo is true, the table follows the binding table of the stack. The whole table of the stack,
+ * including the bindings restored from its storage, is read with Mgmt_Bind_req sent to this device and answered
+ * locally by its stack: at the initialization if the device is already on a network, then each time it forms, joins
+ * or rejoins a network. The ZDO Bind_req and Unbind_req received for this device are applied once the stack has
+ * accepted them: after the stack has processed the requests, its binding table is read again, a Bind_req is applied
+ * if its binding is there and an Unbind_req if its binding is not. Up to 4 requests are checked at a time, the
+ * further ones are counted in @p zdo_dropped of @ref ezb_aps_binding_index_stats_s.
+ *
+ * @note The table is held in RAM only, it is filled again from the stack after a reboot when @p mirror_zdo is true.
+ *       The bindings the stack creates or removes without a Bind_req or Unbind_req, e.g. by the finding and binding,
+ *       are only mirrored at the next read of the whole table.
+ */
+typedef struct ezb_aps_binding_index_config_s {
+    uint16_t src_size;   /*!< The maximum number of source endpoint and cluster pairs. */
+    uint16_t dst_size;   /*!< The maximum number of destinations. */
+    bool     mirror_zdo; /*!< Apply the received ZDO Bind_req and Unbind_req accepted by the stack to the table. */
+} ezb_aps_binding_index_config_t;
+
+/**
+ * @brief Statistics of the indexed binding table
+ */
+typedef struct ezb_aps_binding_index_stats_s {
+    uint16_t src_used;       /*!< The number of source endpoint and cluster pairs. */
+    uint16_t dst_used;       /*!< The number of destinations. */
+    uint32_t syncs;          /*!< Number of complete reads of the binding table of the stack. */
+    uint32_t sync_dropped;   /*!< Number of bindings of the stack not mirrored because the table is full. */
+    uint32_t zdo_dropped;    /*!< Number of ZDO Bind_req and Unbind_req not mirrored, too many at a time or unchecked. */
+    uint32_t query_failures; /*!< Number of reads of the binding table of the stack that failed. */
+} ezb_aps_binding_index_stats_t;
+
+/**
+ * @brief Initialize the indexed binding table.
+ *
+ * @param[in] config The configuration, @ref ezb_aps_binding_index_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The table is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_aps_binding_index_init(const ezb_aps_binding_index_config_t *config);
+
+/**
+ * @brief Deinitialize the indexed binding table, the bindings are discarded.
+ */
+void ezb_aps_binding_index_deinit(void);
+
+/**
+ * @brief Add bindings to the table, the bindings already present are skipped.
+ *
+ * @param[in]  bindings The bindings, @ref ezb_aps_binding_s
+ * @param[in]  count    The number of bindings.
+ * @param[out] added    The number of bindings processed before an error, can be NULL.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments, or a binding with an invalid destination address mode
+ *      - EZB_ERR_INV_STATE: The table is not initialized
+ *      - EZB_ERR_NO_MEM: The table is full
+ */
+ezb_err_t ezb_aps_binding_add_batch(const ezb_aps_binding_t *bindings, uint16_t count, uint16_t *added);
+
+/**
+ * @brief Remove bindings from the table, the bindings absent are skipped.
+ *
+ * @param[in] bindings The bindings, @ref ezb_aps_binding_s
+ * @param[in] count    The number of bindings.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_INV_STATE: The table is not initialized
+ */
+ezb_err_t ezb_aps_binding_remove_batch(const ezb_aps_binding_t *bindings, uint16_t count);
+
+/**
+ * @brief Get the next binding of a source endpoint and cluster.
+ *
+ * @note The table must not be modified during the iteration.
+ *
+ * @param[in]     src_endpoint The source endpoint.
+ * @param[in]     cluster_id   The cluster identifier.
+ * @param[in,out] iter         The iterator, set it to 0 to get the first binding.
+ * @param[out]    binding      The binding, @ref ezb_aps_binding_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_NOT_FOUND: No more binding
+ */
+ezb_err_t ezb_aps_binding_get_next(uint8_t src_endpoint, uint16_t cluster_id, uint16_t *iter,
+                                   ezb_aps_binding_t *binding);
+
+/**
+ * @brief Issue an APSDE-DATA request to each binding of its source endpoint and cluster.
+ *
+ * The destination of @p req is ignored, a request is issued for each destination bound to @p req->src_endpoint and
+ * @p req->cluster_id.
+ *
+ * @param[in]  req  The request, @ref ezb_apsde_data_req_s
+ * @param[out] sent The number of requests accepted by the stack, can be NULL.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_INV_STATE: The table is not initialized
+ *      - EZB_ERR_NOT_FOUND: No binding
+ *      - Other error codes of @ref ezb_apsde_data_request, the first one returned
+ */
+ezb_err_t ezb_aps_binding_data_request(const ezb_apsde_data_req_t *req, uint16_t *sent);
+
+/**
+ * @brief Get the statistics of the indexed binding table.
+ *
+ * @param[out] stats The statistics, @ref ezb_aps_binding_index_stats_s
+ */
+void ezb_aps_binding_index_get_stats(ezb_aps_binding_index_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_APS_BINDING_H */
@@ -0,0 +1,142 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_APS_BUFFER_H
+#define ESP_ZIGBEE_APS_BUFFER_H
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EZB_APS_BUFFER_MAX_SIZE 25600U /*!< The largest buffer size, above the ASDU of any fragmented transfer. */
+
+/**
+ * @brief Configuration of the ASDU buffer pool
+ *
+ * The pool holds @p count buffers of @p size bytes, allocated once. A buffer is lent to the application, which
+ * serializes an ASDU into it and hands it back with @ref ezb_aps_buffer_data_request, instead of allocating a scratch
+ * buffer of its own for every request. A received ASDU can be kept past the indication callback in a buffer of the
+ * pool, see @ref ezb_aps_buffer_retain_indication.
+ *
+ * The pool is a buffer pool, not a zero-copy path: the stack still copies the ASDU of a request into its own buffer,
+ * and retaining an indication copies its ASDU into a buffer of the pool. The stack takes no external buffer, so the
+ * copy into the stack cannot be avoided. What the pool provides over a scratch buffer of the application:
+ * - The memory is allocated once at init, the requests and the retained indications allocate nothing from the heap,
+ *   so a long running gateway does not fragment it, and the memory they use is bounded by @p count.
+ * - The buffers are reference counted, a buffer returns to the pool when its last reference is released. An ASDU
+ *   serialized once can be sent to several destinations, with one reference added per additional request, and an
+ *   indication retained once can be shared by several consumers.
+ *
+ * @note The functions of the pool must be called from the Zigbee task, or with the Zigbee lock held.
+ */
+typedef struct ezb_aps_buffer_pool_config_s {
+    uint16_t count; /*!< The number of buffers. */
+    uint16_t size;  /*!< The size of a buffer, in bytes, the largest ASDU it can hold, up to
+                         @ref EZB_APS_BUFFER_MAX_SIZE. */
+} ezb_aps_buffer_pool_config_t;
+
+/**
+ * @brief Statistics of the ASDU buffer pool
+ */
+typedef struct ezb_aps_buffer_pool_stats_s {
+    uint16_t count;          /*!< The number of buffers. */
+    uint16_t free;           /*!< The number of buffers in the pool. */
+    uint16_t low_water;      /*!< The lowest number of buffers in the pool. */
+    uint32_t alloc_failures; /*!< Number of requests for a buffer while the pool was empty. */
+} ezb_aps_buffer_pool_stats_t;
+
+/**
+ * @brief Initialize the ASDU buffer pool.
+ *
+ * @param[in] config The configuration, @ref ezb_aps_buffer_pool_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The pool is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_aps_buffer_pool_init(const ezb_aps_buffer_pool_config_t *config);
+
+/**
+ * @brief Deinitialize the ASDU buffer pool.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_STATE: The pool is not initialized
+ *      - EZB_ERR_BUSY: Buffers are still referenced, the pool is kept
+ */
+ezb_err_t ezb_aps_buffer_pool_deinit(void);
+
+/**
+ * @brief Borrow a buffer from the pool.
+ *
+ * @param[out] size The size of the buffer, can be NULL.
+ *
+ * @return The buffer with one reference, NULL if the pool is empty or not initialized.
+ */
+uint8_t *ezb_aps_buffer_alloc(uint16_t *size);
+
+/**
+ * @brief Add a reference to a buffer of the pool.
+ *
+ * @param[in] buf The buffer.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: @p buf is not a buffer of the pool, or it is not borrowed
+ *      - EZB_ERR_NOT_ALLOWED: The buffer already has the maximum number of references, 255
+ */
+ezb_err_t ezb_aps_buffer_ref(uint8_t *buf);
+
+/**
+ * @brief Release a reference to a buffer of the pool.
+ *
+ * @param[in] buf The buffer, NULL is ignored.
+ */
+void ezb_aps_buffer_release(uint8_t *buf);
+
+/**
+ * @brief Issue an APSDE-DATA request whose ASDU has been serialized into a buffer of the pool.
+ *
+ * The reference of the caller to @p req->asdu is consumed, whatever the result.
+ *
+ * @param[in] req The request, @ref ezb_apsde_data_req_s, @p asdu is a buffer of the pool.
+ *
+ * @return
+ *      - EZB_ERR_INV_ARG: @p asdu is not a buffer of the pool, or @p asdu_length exceeds the buffer
+ *      - Other error codes of @ref ezb_apsde_data_request
+ */
+ezb_err_t ezb_aps_buffer_data_request(const ezb_apsde_data_req_t *req);
+
+/**
+ * @brief Keep the ASDU of an indication past the indication callback.
+ *
+ * The ASDU is placed in a buffer of the pool, the buffer is released with @ref ezb_aps_buffer_release.
+ *
+ * @param[in] ind The indication, @ref ezb_apsde_data_ind_s
+ *
+ * @return The buffer holding the ASDU with one reference, NULL if the pool is empty, not initialized or the ASDU does
+ *         not fit in a buffer.
+ */
+uint8_t *ezb_aps_buffer_retain_indication(const ezb_apsde_data_ind_t *ind);
+
+/**
+ * @brief Get the statistics of the ASDU buffer pool.
+ *
+ * @param[out] stats The statistics, @ref ezb_aps_buffer_pool_stats_s
+ */
+void ezb_aps_buffer_pool_get_stats(ezb_aps_buffer_pool_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_APS_BUFFER_H */
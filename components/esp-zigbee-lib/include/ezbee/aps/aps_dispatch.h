@@ -0,0 +1,71 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_APS_DISPATCH_H
+#define ESP_ZIGBEE_APS_DISPATCH_H
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EZB_APS_DISPATCH_ANY_PROFILE  0xFFFFU /*!< Match the indications of any profile. */
+#define EZB_APS_DISPATCH_ANY_CLUSTER  0xFFFFU /*!< Match the indications of any cluster. */
+#define EZB_APS_DISPATCH_ANY_ENDPOINT 0xFFU   /*!< Match the indications to any endpoint. */
+
+/**
+ * @brief A handler of the APSDE-DATA indications matching a filter
+ *
+ * The handlers are indexed by their filter, so that finding those of an indication does not depend on the number of
+ * handlers registered. The handlers matching an indication run by decreasing @p priority, the more specific filter
+ * first for the same priority, then in the order of registration, until one of them returns true to consume the
+ * indication. The indications not consumed are passed to the callback registered with
+ * @ref ezb_apsde_data_indication_handler_register, then to the stack.
+ *
+ * @note The handler object is owned by the caller, it must stay valid and its filter must not change until it is
+ *       unregistered. A handler may unregister itself from its callback.
+ */
+typedef struct ezb_aps_dispatch_handler_s {
+    uint16_t profile_id;  /*!< The profile identifier, or @ref EZB_APS_DISPATCH_ANY_PROFILE. */
+    uint16_t cluster_id;  /*!< The cluster identifier, or @ref EZB_APS_DISPATCH_ANY_CLUSTER. */
+    uint8_t  endpoint;    /*!< The destination endpoint, or @ref EZB_APS_DISPATCH_ANY_ENDPOINT. */
+    uint8_t  priority;    /*!< The priority, the higher runs first. */
+    ezb_apsde_data_indication_callback_t callback; /*!< The callback, return true to consume the indication. */
+    struct ezb_aps_dispatch_handler_s *next;       /*!< Internal use, the next handler of the same bucket. */
+} ezb_aps_dispatch_handler_t;
+
+/**
+ * @brief Register a handler of the APSDE-DATA indications.
+ *
+ * @param[in] handler The handler, @ref ezb_aps_dispatch_handler_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_INV_STATE: The handler is already registered
+ */
+ezb_err_t ezb_aps_dispatch_register(ezb_aps_dispatch_handler_t *handler);
+
+/**
+ * @brief Unregister a handler of the APSDE-DATA indications.
+ *
+ * @param[in] handler The handler, @ref ezb_aps_dispatch_handler_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_NOT_FOUND: The handler is not registered
+ */
+ezb_err_t ezb_aps_dispatch_unregister(ezb_aps_dispatch_handler_t *handler);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_APS_DISPATCH_H */
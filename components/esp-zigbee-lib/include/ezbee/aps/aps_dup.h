@@ -0,0 +1,87 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_APS_DUP_H
+#define ESP_ZIGBEE_APS_DUP_H
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The default lifetime of an entry of the APS duplicate rejection table, in milliseconds.
+ */
+#define EZB_APS_DUP_TABLE_DEFAULT_EXPIRY 10000U
+
+/**
+ * @brief Configuration of the APS duplicate rejection table
+ *
+ * The table holds the source address, APS counter and block number of the unicast APS data frames received for this
+ * device, in a fixed size hashed table of @p size entries, each lookup probing at most 8 entries. An entry expires
+ * after @p expiry, a new entry replaces an expired one, or the oldest one of its probe window.
+ *
+ * The table is an extra filter in front of the application, the stack keeps its own duplicate rejection. A duplicate
+ * frame is still processed by the stack as any other, e.g. for the neighbor, link quality and frame counter updates,
+ * only its APSDE-DATA.indication is dropped before the application. A frame is a duplicate by its source and APS
+ * counter only: the same content sent again with a new APS counter, e.g. two toggle commands, is delivered. The
+ * content only tells apart the frames of a source waiting for their indication at the same time. The duplicates
+ * requesting an APS acknowledgement, the fragments and the ASDUs secured at the APS layer are left to the stack. The
+ * broadcast and group frames are not checked.
+ *
+ * @note The NWK payload of the unicast frames is decrypted once more, the decryption is shared with the NWK replay
+ *       protection when both are enabled.
+ */
+typedef struct ezb_aps_dup_table_config_s {
+    uint16_t size;   /*!< The number of entries of the table. */
+    uint32_t expiry; /*!< The lifetime of an entry, in milliseconds, 0 for @ref EZB_APS_DUP_TABLE_DEFAULT_EXPIRY. */
+} ezb_aps_dup_table_config_t;
+
+/**
+ * @brief Statistics of the APS duplicate rejection table
+ */
+typedef struct ezb_aps_dup_table_stats_s {
+    uint16_t size;      /*!< The number of entries of the table. */
+    uint16_t used;      /*!< The number of entries in use, expired or not. */
+    uint32_t hits;      /*!< Number of duplicate frames detected. */
+    uint32_t dropped;   /*!< Number of duplicate indications dropped before the application. */
+    uint32_t misses;    /*!< Number of frames not found in the table, and added to it. */
+    uint32_t evictions; /*!< Number of entries replaced before their expiry. */
+} ezb_aps_dup_table_stats_t;
+
+/**
+ * @brief Initialize the APS duplicate rejection table.
+ *
+ * @param[in] config The configuration, @ref ezb_aps_dup_table_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The table is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_aps_dup_table_init(const ezb_aps_dup_table_config_t *config);
+
+/**
+ * @brief Deinitialize the APS duplicate rejection table.
+ */
+void ezb_aps_dup_table_deinit(void);
+
+/**
+ * @brief Get the statistics of the APS duplicate rejection table.
+ *
+ * @param[out] stats The statistics, @ref ezb_aps_dup_table_stats_s, all zero if there is no table.
+ */
+void ezb_aps_dup_table_get_stats(ezb_aps_dup_table_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_APS_DUP_H */
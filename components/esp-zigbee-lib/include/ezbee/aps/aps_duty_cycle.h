@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_APS_DUTY_CYCLE_H
+#define ESP_ZIGBEE_APS_DUTY_CYCLE_H
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the duty cycle limiter
+ *
+ * The limiter compares the transmit air time of the device over the last minute, see @ref ezb_mac_airtime_get_local,
+ * with @p budget. While the budget is exceeded, the requests submitted with a priority below @p exempt_priority are
+ * delayed in a queue of @p depth requests, and released one at a time once the air time falls below the budget again.
+ * A request delayed for more than @p max_delay is discarded.
+ */
+typedef struct ezb_aps_duty_cycle_config_s {
+    uint16_t budget;          /*!< The transmit air time budget, in per mille of the last minute. */
+    uint8_t  exempt_priority; /*!< The requests with this priority or above are never delayed. */
+    uint8_t  depth;           /*!< The maximum number of delayed requests. */
+    uint32_t max_delay;       /*!< The maximum delay of a request, in milliseconds. */
+} ezb_aps_duty_cycle_config_t;
+
+/**
+ * @brief Statistics of the duty cycle limiter
+ */
+typedef struct ezb_aps_duty_cycle_stats_s {
+    uint32_t tx_airtime; /*!< The transmit air time over the last minute, in microseconds. */
+    bool     exceeded;   /*!< Whether the budget is currently exceeded. */
+    uint8_t  queued;     /*!< Number of requests currently delayed. */
+    uint32_t delayed;    /*!< Number of requests delayed. */
+    uint32_t released;   /*!< Number of delayed requests released to the stack. */
+    uint32_t discarded;  /*!< Number of delayed requests discarded after @p max_delay. */
+    uint32_t rejected;   /*!< Number of requests rejected because the queue was full. */
+} ezb_aps_duty_cycle_stats_t;
+
+/**
+ * @brief Initialize the duty cycle limiter.
+ *
+ * @note The airtime accounting must be initialized first, see @ref ezb_mac_airtime_init.
+ *
+ * @param[in] config The configuration, @ref ezb_aps_duty_cycle_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The limiter is already initialized, or the airtime accounting is not
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_aps_duty_cycle_init(const ezb_aps_duty_cycle_config_t *config);
+
+/**
+ * @brief Deinitialize the duty cycle limiter, the delayed requests are discarded.
+ */
+void ezb_aps_duty_cycle_deinit(void);
+
+/**
+ * @brief Submit an APSDE-DATA request through the duty cycle limiter.
+ *
+ * The ASDU is copied when the request is delayed, the caller keeps the ownership of @p req.
+ *
+ * @param[in] req      The request, @ref ezb_apsde_data_req_s
+ * @param[in] priority The priority of the request, 0 being the lowest.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success, the request is sent or delayed
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_INV_STATE: The limiter is not initialized
+ *      - EZB_ERR_BUSY: The budget is exceeded and the queue is full
+ *      - EZB_ERR_NO_MEM: Not enough memory to delay the request
+ *      - Other error codes of @ref ezb_apsde_data_request
+ */
+ezb_err_t ezb_aps_duty_cycle_data_request(const ezb_apsde_data_req_t *req, uint8_t priority);
+
+/**
+ * @brief Get the statistics of the duty cycle limiter.
+ *
+ * @param[out] stats The statistics, @ref ezb_aps_duty_cycle_stats_s
+ */
+void ezb_aps_duty_cycle_get_stats(ezb_aps_duty_cycle_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_APS_DUTY_CYCLE_H */
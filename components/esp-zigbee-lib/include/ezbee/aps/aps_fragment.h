@@ -0,0 +1,128 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_APS_FRAGMENT_H
+#define ESP_ZIGBEE_APS_FRAGMENT_H
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief A completed fragmented transfer
+ */
+typedef struct ezb_aps_fragment_transfer_s {
+    ezb_address_t dst_address; /*!< The destination of the transfer. */
+    uint16_t cluster_id;       /*!< The cluster of the transfer. */
+    uint16_t length;           /*!< The length of the ASDU, in bytes. */
+    uint8_t status;            /*!< The status of the APSDE-DATA.confirm, 0 on success. */
+    uint8_t window_size;       /*!< The window size used for the transfer. */
+    uint8_t interframe_delay;  /*!< The interframe delay used for the transfer, in milliseconds. */
+    uint32_t duration;         /*!< The time from the request to the confirm, in milliseconds. */
+    uint32_t throughput;       /*!< The throughput of a successful transfer, in bytes per second. */
+} ezb_aps_fragment_transfer_t;
+
+/**
+ * @brief Callback reporting a completed fragmented transfer
+ *
+ * @param[in] transfer The transfer, @ref ezb_aps_fragment_transfer_s
+ */
+typedef void (*ezb_aps_fragment_transfer_callback_t)(const ezb_aps_fragment_transfer_t *transfer);
+
+/**
+ * @brief Configuration of the adaptive fragmentation
+ *
+ * The interframe delay, see @ref ezb_aps_set_fragment_interframe_delay, is kept per destination and applied to each
+ * acknowledged unicast request that permits fragmentation. It is adapted from the outcome of the transfers, in an
+ * additive increase, multiplicative decrease way:
+ *  - A failed transfer doubles the delay.
+ *  - A transfer that takes more than twice the usual time per byte of the destination increases the delay by
+ *    @p delay_step.
+ *  - Any other successful transfer decreases the delay by @p delay_step.
+ *
+ * With @p adapt_window, the window size, see @ref ezb_aps_set_fragment_max_window_size, is adapted the same way: it is
+ * halved by a failed transfer, shrunk by one by a slow one and grown by one otherwise. The receiver acknowledges each
+ * window, so this only helps when the peers handle any window size up to @p max_window_size. Without it, the window
+ * size of the stack is left as is.
+ *
+ * A destination starts with @p min_delay and, with @p adapt_window, @p max_window_size. Up to @p max_destinations
+ * destinations are tracked, the least recently used one is replaced.
+ *
+ * The window size and the interframe delay are global settings of the stack, which apply to every transfer in
+ * progress. A single transfer is therefore adapted at a time: a transfer requested while another one is in progress
+ * runs with the settings already in effect, and is neither timed nor reported. A transfer whose confirm is not seen
+ * within 30 seconds no longer holds the settings.
+ *
+ * @note The transfers complete on the APSDE-DATA.confirm, which is only seen while the application has registered a
+ *       confirm handler, see @ref ezb_apsde_data_confirm_handler_register.
+ * @note Only the requests of the application through @ref ezb_apsde_data_request are adapted. The large payloads the
+ *       stack sends itself, e.g. the ZCL commands and responses built by the ZCL layer, do not go through that
+ *       function: they are neither adapted nor timed, and are sent with the settings in effect at that time.
+ */
+typedef struct ezb_aps_fragment_adaptive_config_s {
+    bool adapt_window;        /*!< Adapt the window size as well, false to only adapt the interframe delay. */
+    uint8_t min_window_size;  /*!< The minimum window size, from 1 to 8, used with @p adapt_window. */
+    uint8_t max_window_size;  /*!< The maximum window size, from @p min_window_size to 8, used with @p adapt_window. */
+    uint8_t min_delay;        /*!< The minimum interframe delay, in milliseconds. */
+    uint8_t max_delay;        /*!< The maximum interframe delay, in milliseconds. */
+    uint8_t delay_step;       /*!< The additive step of the interframe delay, in milliseconds. */
+    uint8_t max_destinations; /*!< The maximum number of destinations tracked. */
+    ezb_aps_fragment_transfer_callback_t transfer_cb; /*!< Called for each completed transfer, can be NULL. */
+} ezb_aps_fragment_adaptive_config_t;
+
+/**
+ * @brief Statistics of the fragmented transfers to a destination
+ */
+typedef struct ezb_aps_fragment_stats_s {
+    uint8_t window_size;      /*!< The current window size. */
+    uint8_t interframe_delay; /*!< The current interframe delay, in milliseconds. */
+    uint32_t transfers;       /*!< Number of completed transfers. */
+    uint32_t failures;        /*!< Number of failed transfers. */
+    uint32_t bytes;           /*!< Number of bytes transferred with success. */
+    uint32_t last_throughput; /*!< The throughput of the last successful transfer, in bytes per second. */
+    uint32_t avg_throughput;  /*!< The smoothed throughput of the successful transfers, in bytes per second. */
+} ezb_aps_fragment_stats_t;
+
+/**
+ * @brief Enable the adaptive fragmentation.
+ *
+ * @param[in] config The configuration, @ref ezb_aps_fragment_adaptive_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The adaptive fragmentation is already enabled
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_aps_fragment_adaptive_init(const ezb_aps_fragment_adaptive_config_t *config);
+
+/**
+ * @brief Disable the adaptive fragmentation, the static window size and interframe delay are restored.
+ */
+void ezb_aps_fragment_adaptive_deinit(void);
+
+/**
+ * @brief Get the statistics of the fragmented transfers to a destination.
+ *
+ * @param[in]  dst_address The destination, with the address mode used in the requests.
+ * @param[out] stats       The statistics, @ref ezb_aps_fragment_stats_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_NOT_FOUND: The destination is not tracked
+ */
+ezb_err_t ezb_aps_fragment_get_stats(const ezb_address_t *dst_address, ezb_aps_fragment_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_APS_FRAGMENT_H */
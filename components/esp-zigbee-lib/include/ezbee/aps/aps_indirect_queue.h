@@ -0,0 +1,115 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_APS_INDIRECT_QUEUE_H
+#define ESP_ZIGBEE_APS_INDIRECT_QUEUE_H
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the indirect queues of the sleepy children
+ *
+ * Each sleepy child has its own queue of up to @p depth APSDE-DATA requests in front of the indirect queue of the
+ * stack. The requests are handed over to the stack as they are submitted, the highest priority first, as long as the
+ * stack holds fewer than @p burst requests for the child. The stack sets the frame pending bit for the child while
+ * it holds a frame, and delivers its frames on the polls of the child. Every data frame delivered to the child frees a
+ * slot and hands the next queued request over, so the child drains its backlog over consecutive polls.
+ *
+ * The frames sent by the stack on its own account also free a slot, so the stack may briefly hold more than
+ * @p burst requests for the child. A slot whose frame is not delivered within the MAC transaction persistence time,
+ * see @ref ezb_mac_set_transaction_persistence_time, is taken as expired in the stack and freed.
+ *
+ * A request that is not handed over to the stack within @p expiry is discarded.
+ */
+typedef struct ezb_aps_indirect_queue_config_s {
+    uint8_t  max_children; /*!< The maximum number of sleepy children with a queue. */
+    uint8_t  depth;        /*!< The maximum number of requests queued for a child. */
+    uint8_t  burst;        /*!< The maximum number of requests of a child held by the stack at a time. */
+    uint32_t expiry;       /*!< The lifetime of a queued request, in milliseconds. */
+} ezb_aps_indirect_queue_config_t;
+
+/**
+ * @brief Statistics of the indirect queue of a sleepy child
+ */
+typedef struct ezb_aps_indirect_queue_stats_s {
+    uint8_t  depth;      /*!< Number of requests in the queue. */
+    uint8_t  high_water; /*!< Highest number of requests in the queue. */
+    uint32_t queued;     /*!< Number of requests queued. */
+    uint32_t coalesced;  /*!< Number of queued requests replaced by a newer request of the same kind. */
+    uint32_t released;   /*!< Number of requests handed over to the stack. */
+    uint32_t expired;    /*!< Number of requests discarded on expiry. */
+    uint32_t dropped;    /*!< Number of requests discarded because the queue was full. */
+    uint32_t polls;      /*!< Number of polls received from the child. */
+} ezb_aps_indirect_queue_stats_t;
+
+/**
+ * @brief Initialize the indirect queues of the sleepy children.
+ *
+ * @param[in] config The configuration, @ref ezb_aps_indirect_queue_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The indirect queues are already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_aps_indirect_queue_init(const ezb_aps_indirect_queue_config_t *config);
+
+/**
+ * @brief Deinitialize the indirect queues, the queued requests are discarded.
+ */
+void ezb_aps_indirect_queue_deinit(void);
+
+/**
+ * @brief Submit an APSDE-DATA request through the indirect queues.
+ *
+ * @note A request whose destination is not a sleepy child of the device is passed to @ref ezb_apsde_data_request
+ *       directly. The ASDU is copied.
+ *
+ * When @p coalesce is true, a queued request of the same kind is replaced. Two requests are of the same kind if they
+ * have the same destination endpoint and cluster, and, for ZCL frames, the same frame type, direction, manufacturer
+ * code and command. ZDO requests (destination endpoint 0) are never coalesced.
+ *
+ * When the queue is full, the oldest request of the lowest priority is discarded if its priority is lower than
+ * @p priority, otherwise the request is rejected.
+ *
+ * @param[in] req      The APSDE-DATA request, @ref ezb_apsde_data_req_s
+ * @param[in] priority The priority of the request, higher is released first.
+ * @param[in] coalesce Whether the request replaces a queued request of the same kind.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_INV_STATE: The indirect queues are not initialized
+ *      - EZB_ERR_NO_MEM: The queue is full, or no queue is left for the child
+ *      - Other error codes of @ref ezb_apsde_data_request
+ */
+ezb_err_t ezb_aps_indirect_queue_submit(const ezb_apsde_data_req_t *req, uint8_t priority, bool coalesce);
+
+/**
+ * @brief Get the statistics of the indirect queue of a sleepy child.
+ *
+ * @param[in]  short_addr The short address of the child.
+ * @param[out] stats      The statistics, @ref ezb_aps_indirect_queue_stats_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_NOT_FOUND: The child has no queue
+ */
+ezb_err_t ezb_aps_indirect_queue_get_stats(ezb_shortaddr_t short_addr, ezb_aps_indirect_queue_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_APS_INDIRECT_QUEUE_H */
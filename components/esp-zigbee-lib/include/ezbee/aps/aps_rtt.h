@@ -0,0 +1,107 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_APS_RTT_H
+#define ESP_ZIGBEE_APS_RTT_H
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the round trip time estimator
+ *
+ * The round trip time of the acknowledged unicast requests is measured from the APSDE-DATA.request to its successful
+ * APSDE-DATA.confirm, and smoothed per destination the way TCP does, see RFC 6298: the smoothed round trip time and
+ * its variation give a timeout of SRTT + 4 * RTTVAR, bounded by @p min_timeout and @p max_timeout. A failed request
+ * doubles the timeout of its destination until the next measurement.
+ *
+ * The stack retries an unacknowledged request after its APS acknowledgement wait, and the confirm does not tell which
+ * transmission has been acknowledged. A confirm later than @p ack_wait is not sampled, see Karn's algorithm. The
+ * retries of the MAC layer within a transmission still count in the round trip time. With @p ack_wait set to 0, every
+ * successful confirm is sampled, and the estimate is biased upwards on the lossy links.
+ *
+ * Up to @p max_inflight requests are timed at the same time, and up to @p max_destinations destinations are tracked,
+ * the least recently used one is replaced.
+ *
+ * The timeout is meant for the application level retries and response timeouts, for instance a ZDO or ZCL response
+ * awaited from the destination, see @ref ezb_aps_rtt_get_timeout.
+ *
+ * @note The requests complete on the APSDE-DATA.confirm, which is only seen while the application has registered a
+ *       confirm handler, see @ref ezb_apsde_data_confirm_handler_register.
+ */
+typedef struct ezb_aps_rtt_config_s {
+    uint8_t  max_destinations; /*!< The maximum number of destinations tracked. */
+    uint8_t  max_inflight;     /*!< The maximum number of requests timed at the same time. */
+    uint32_t min_timeout;      /*!< The lower bound of the timeout, in milliseconds. */
+    uint32_t max_timeout;      /*!< The upper bound of the timeout, in milliseconds. */
+    uint32_t initial_timeout;  /*!< The timeout of a destination without measurement, in milliseconds. */
+    uint32_t ack_wait;         /*!< The APS acknowledgement wait of the stack, in milliseconds, 0 to sample every
+                                    confirm. */
+} ezb_aps_rtt_config_t;
+
+/**
+ * @brief Round trip time estimate of a destination
+ */
+typedef struct ezb_aps_rtt_estimate_s {
+    uint32_t srtt;      /*!< The smoothed round trip time, in milliseconds. */
+    uint32_t rttvar;    /*!< The round trip time variation, in milliseconds. */
+    uint32_t timeout;   /*!< The current timeout, in milliseconds. */
+    uint32_t samples;   /*!< Number of round trip time measurements. */
+    uint32_t failures;  /*!< Number of failed requests. */
+    uint32_t discarded; /*!< Number of successful requests confirmed too late to be sampled. */
+} ezb_aps_rtt_estimate_t;
+
+/**
+ * @brief Initialize the round trip time estimator.
+ *
+ * @param[in] config The configuration, @ref ezb_aps_rtt_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The estimator is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_aps_rtt_init(const ezb_aps_rtt_config_t *config);
+
+/**
+ * @brief Deinitialize the round trip time estimator.
+ */
+void ezb_aps_rtt_deinit(void);
+
+/**
+ * @brief Get the round trip time estimate of a destination.
+ *
+ * @param[in]  dst_address The destination, with the address mode used in the requests.
+ * @param[out] estimate    The estimate, @ref ezb_aps_rtt_estimate_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_NOT_FOUND: The destination is not tracked
+ */
+ezb_err_t ezb_aps_rtt_get_estimate(const ezb_address_t *dst_address, ezb_aps_rtt_estimate_t *estimate);
+
+/**
+ * @brief Get the timeout of a destination.
+ *
+ * @param[in] dst_address The destination, with the address mode used in the requests.
+ *
+ * @return The timeout in milliseconds, @p initial_timeout if the destination is not tracked, 0 if the estimator is not
+ *         initialized.
+ */
+uint32_t ezb_aps_rtt_get_timeout(const ezb_address_t *dst_address);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_APS_RTT_H */
@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_APS_STATS_H
+#define ESP_ZIGBEE_APS_STATS_H
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief APS layer counters
+ *
+ * The counters are kept with the MAC and NWK counters in a single structure, see @ref ezb_mac_stats_s.
+ *
+ * The transmissions are counted from the APSDE-DATA requests issued by the application, and from the APSDE-DATA
+ * confirms while the application has registered a confirm handler, see @ref ezb_apsde_data_confirm_handler_register.
+ */
+typedef struct ezb_aps_stats_s {
+    uint32_t tx_ucast_success;      /*!< Number of unicast requests confirmed with success. */
+    uint32_t tx_ucast_fail;         /*!< Number of unicast requests confirmed with a failure. */
+    uint32_t tx_bcast;              /*!< Number of application-issued broadcast and group requests accepted by the
+                                         stack. */
+    uint32_t rx_ucast;              /*!< Number of unicast indications. */
+    uint32_t rx_bcast;              /*!< Number of broadcast and group indications. */
+    uint32_t buffer_alloc_failures; /*!< Number of application-issued requests rejected for lack of memory. */
+} ezb_aps_stats_t;
+
+/**
+ * @brief Enable or disable the APS layer counters.
+ *
+ * @param[in] enable Whether the counters are updated, the counters keep their values when disabled.
+ */
+void ezb_aps_stats_enable(bool enable);
+
+/**
+ * @brief Get a snapshot of the APS layer counters.
+ *
+ * @param[out] stats The counters, @ref ezb_aps_stats_s
+ */
+void ezb_aps_get_stats(ezb_aps_stats_t *stats);
+
+/**
+ * @brief Reset the APS layer counters to zero.
+ */
+void ezb_aps_reset_stats(void);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_APS_STATS_H */
@@ -0,0 +1,170 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_APS_TX_QUEUE_H
+#define ESP_ZIGBEE_APS_TX_QUEUE_H
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Enumeration of the traffic classes of the transmit queue
+ * @anchor ezb_aps_traffic_class_e
+ */
+enum ezb_aps_traffic_class_e {
+    EZB_APS_TRAFFIC_CLASS_CONTROL = 0,   /*!< Network control, served first within its own burst. */
+    EZB_APS_TRAFFIC_CLASS_INTERACTIVE,   /*!< Commands issued by a user, for instance a light toggle. */
+    EZB_APS_TRAFFIC_CLASS_BULK,          /*!< Background transfers, for instance OTA or bulk configuration. */
+    EZB_APS_TRAFFIC_CLASS_MAX,           /*!< Number of traffic classes. */
+};
+
+/**
+ * @brief Represents the traffic class of a request, @ref ezb_aps_traffic_class_e
+ */
+typedef uint8_t ezb_aps_traffic_class_t;
+
+/**
+ * @brief Back-pressure callback of the transmit queue
+ *
+ * @param[in] traffic_class The traffic class, @ref ezb_aps_traffic_class_e
+ * @param[in] congested     True when the queue of the class reached its high watermark, false when it fell back to
+ *                          its low watermark.
+ */
+typedef void (*ezb_aps_tx_queue_pressure_callback_t)(ezb_aps_traffic_class_t traffic_class, bool congested);
+
+/**
+ * @brief Deferred send of the transmit queue, see @ref ezb_aps_tx_queue_send
+ *
+ * @param[in] user_ctx The user context given with the send.
+ *
+ * @return The result of the request issued to the stack, EZB_ERR_NO_MEM or EZB_ERR_BUSY when the stack has no buffer
+ *         for it, in which case it is called again after the release interval.
+ */
+typedef ezb_err_t (*ezb_aps_tx_queue_send_t)(void *user_ctx);
+
+/**
+ * @brief Configuration of a traffic class of the transmit queue
+ */
+typedef struct ezb_aps_tx_queue_class_config_s {
+    uint8_t depth;          /*!< The maximum number of queued requests. */
+    uint8_t weight;         /*!< The number of requests released per scheduling round, not used by the control class. */
+    uint8_t high_watermark; /*!< The number of queued requests signaled as congested, up to @p depth. */
+    uint8_t low_watermark;  /*!< The number of queued requests signaled as relieved, below @p high_watermark. */
+} ezb_aps_tx_queue_class_config_t;
+
+/**
+ * @brief Configuration of the transmit queue
+ *
+ * The requests are queued per traffic class in front of the stack. The control class is released first, up to
+ * @p control_burst requests every @p interval, so that it cannot starve the other classes. The interactive and bulk
+ * classes then share the remaining capacity by weighted round robin. At most @p burst requests of these two classes
+ * are released every @p interval, so that the background traffic does not exhaust the buffers of the stack ahead of
+ * the interactive traffic. When the stack refuses a request for lack of buffers, the request stays at the head of its
+ * queue and the release resumes after @p interval.
+ *
+ * The queue of a class crossing its high or low watermark is signaled with @p pressure_cb, so that the application
+ * can slow down the producers of the class.
+ */
+typedef struct ezb_aps_tx_queue_config_s {
+    ezb_aps_tx_queue_class_config_t classes[EZB_APS_TRAFFIC_CLASS_MAX]; /*!< The configuration of each class. */
+    uint8_t  burst;         /*!< The maximum number of interactive and bulk requests released per interval. */
+    uint8_t  control_burst; /*!< The maximum number of control requests released per interval. */
+    uint16_t interval;      /*!< The release interval, in milliseconds. */
+    ezb_aps_tx_queue_pressure_callback_t pressure_cb; /*!< The back-pressure callback, can be NULL. */
+} ezb_aps_tx_queue_config_t;
+
+/**
+ * @brief Statistics of a traffic class of the transmit queue
+ */
+typedef struct ezb_aps_tx_queue_class_stats_s {
+    uint8_t  queued;    /*!< Number of requests currently queued. */
+    bool     congested; /*!< Whether the class is currently signaled as congested. */
+    uint32_t submitted; /*!< Number of requests submitted. */
+    uint32_t released;  /*!< Number of requests accepted by the stack. */
+    uint32_t failed;    /*!< Number of requests refused by the stack with an error other than a lack of buffers. */
+    uint32_t rejected;  /*!< Number of requests rejected because the queue was full. */
+    uint32_t deferred;  /*!< Number of times the stack had no buffer for the request at the head of the queue. */
+} ezb_aps_tx_queue_class_stats_t;
+
+/**
+ * @brief Initialize the transmit queue.
+ *
+ * @param[in] config The configuration, @ref ezb_aps_tx_queue_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The queue is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_aps_tx_queue_init(const ezb_aps_tx_queue_config_t *config);
+
+/**
+ * @brief Deinitialize the transmit queue, the queued requests are discarded.
+ */
+void ezb_aps_tx_queue_deinit(void);
+
+/**
+ * @brief Submit an APSDE-DATA request through the transmit queue.
+ *
+ * The request is released at once when the scheduling allows it, it is queued otherwise. The ASDU is copied when the
+ * request is queued, the caller keeps the ownership of @p req.
+ *
+ * @param[in] req           The request, @ref ezb_apsde_data_req_s
+ * @param[in] traffic_class The traffic class, @ref ezb_aps_traffic_class_e
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success, the request is sent or queued
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_INV_STATE: The queue is not initialized
+ *      - EZB_ERR_BUSY: The queue of the class is full
+ *      - EZB_ERR_NO_MEM: Not enough memory to queue the request
+ *      - Other error codes of @ref ezb_apsde_data_request
+ */
+ezb_err_t ezb_aps_tx_queue_data_request(const ezb_apsde_data_req_t *req, ezb_aps_traffic_class_t traffic_class);
+
+/**
+ * @brief Submit a deferred send through the transmit queue.
+ *
+ * The queue only sees the APSDE-DATA requests submitted to it, the ZCL commands issued with the ZCL request APIs and
+ * the frames the stack sends on its own, such as the reports and the OTA Upgrade server responses, bypass it. A ZCL
+ * command is scheduled with the traffic of its class by issuing it from @p send, e.g. a bulk configuration write
+ * issued with @ref ezb_zcl_write_attr_cmd_req.
+ *
+ * @p send is called at once when the scheduling allows it, it is queued otherwise. @p user_ctx must stay valid until
+ * @p send is called, the sends still queued at @ref ezb_aps_tx_queue_deinit are discarded without being called.
+ *
+ * @param[in] send          The send, @ref ezb_aps_tx_queue_send_t
+ * @param[in] user_ctx      The user context passed to @p send.
+ * @param[in] traffic_class The traffic class, @ref ezb_aps_traffic_class_e
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success, the send is done or queued
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_INV_STATE: The queue is not initialized
+ *      - EZB_ERR_BUSY: The queue of the class is full
+ *      - Other error codes returned by @p send
+ */
+ezb_err_t ezb_aps_tx_queue_send(ezb_aps_tx_queue_send_t send, void *user_ctx, ezb_aps_traffic_class_t traffic_class);
+
+/**
+ * @brief Get the statistics of a traffic class of the transmit queue.
+ *
+ * @param[in]  traffic_class The traffic class, @ref ezb_aps_traffic_class_e
+ * @param[out] stats         The statistics, @ref ezb_aps_tx_queue_class_stats_s
+ */
+void ezb_aps_tx_queue_get_stats(ezb_aps_traffic_class_t traffic_class, ezb_aps_tx_queue_class_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_APS_TX_QUEUE_H */
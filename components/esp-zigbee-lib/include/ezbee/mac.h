@@ -72,4 +72,9 @@ ezb_err_t ezb_mac_get_csma_ca_params(ezb_mac_csma_ca_params_t *params);
 } /*  extern "C" */
 #endif
 
+#include <ezbee/mac/mac_csma_ca.h>
+#include <ezbee/mac/mac_stats.h>
+#include <ezbee/mac/mac_airtime.h>
+#include <ezbee/mac/mac_capture.h>
+
 #endif /* ESP_ZIGBEE_MAC_H */
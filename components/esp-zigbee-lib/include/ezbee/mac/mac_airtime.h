@@ -0,0 +1,99 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_MAC_AIRTIME_H
+#define ESP_ZIGBEE_MAC_AIRTIME_H
+
+#include <ezbee/mac.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the airtime accounting
+ *
+ * The air time of a frame is computed from its PSDU length, including the synchronization and PHY headers, at
+ * EZB_RADIO_SYMBOLS_PER_OCTET symbols of EZB_RADIO_SYMBOL_TIME per octet. The transmitted frames are accounted to the
+ * device and to the MAC destination, the received frames to the device and to the MAC source, and a received
+ * acknowledgement to the destination of the acknowledged frame.
+ *
+ * The windows are rolling, in buckets of 10 seconds for the minute window and of 5 minutes for the hour window, so the
+ * oldest bucket of a window is partially expired. When the table of the devices is full, the least recently active
+ * device is replaced.
+ */
+typedef struct ezb_mac_airtime_config_s {
+    uint16_t max_devices; /*!< The maximum number of devices accounted separately. */
+} ezb_mac_airtime_config_t;
+
+/**
+ * @brief Air time over the rolling windows, in microseconds
+ */
+typedef struct ezb_mac_airtime_s {
+    uint32_t tx_minute; /*!< Air time of the transmissions over the last minute. */
+    uint32_t rx_minute; /*!< Air time of the receptions over the last minute. */
+    uint32_t tx_hour;   /*!< Air time of the transmissions over the last hour. */
+    uint32_t rx_hour;   /*!< Air time of the receptions over the last hour. */
+} ezb_mac_airtime_t;
+
+/**
+ * @brief Air time of a remote device, the transmissions are those of this device to it, the receptions those from it.
+ */
+typedef struct ezb_mac_airtime_device_s {
+    ezb_address_t addr;        /*!< The MAC address of the device, short or extended. */
+    ezb_mac_airtime_t airtime; /*!< The air time, @ref ezb_mac_airtime_s */
+} ezb_mac_airtime_device_t;
+
+/**
+ * @brief Initialize the airtime accounting.
+ *
+ * @param[in] config The configuration, @ref ezb_mac_airtime_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The accounting is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_mac_airtime_init(const ezb_mac_airtime_config_t *config);
+
+/**
+ * @brief Deinitialize the airtime accounting.
+ */
+void ezb_mac_airtime_deinit(void);
+
+/**
+ * @brief Get the air time of all the frames transmitted and received by this device.
+ *
+ * @param[out] airtime The air time, @ref ezb_mac_airtime_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_INV_STATE: The accounting is not initialized
+ */
+ezb_err_t ezb_mac_airtime_get_local(ezb_mac_airtime_t *airtime);
+
+/**
+ * @brief Iterate over the devices accounted, typically to find the devices using the most air time.
+ *
+ * @param[in,out] index  The iterator, start from 0.
+ * @param[out]    device The air time of the next device, @ref ezb_mac_airtime_device_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_NOT_FOUND: No more device
+ */
+ezb_err_t ezb_mac_airtime_get_next_device(uint16_t *index, ezb_mac_airtime_device_t *device);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_MAC_AIRTIME_H */
@@ -0,0 +1,95 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_MAC_CAPTURE_H
+#define ESP_ZIGBEE_MAC_CAPTURE_H
+
+#include <stddef.h>
+
+#include <ezbee/mac.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Output of the capture, called from the capture task.
+ *
+ * @param[in] data   The pcapng data to write.
+ * @param[in] length The length of @p data.
+ * @param[in] ctx    The user context of @ref ezb_mac_capture_config_s.
+ *
+ * @return true if the data has been written, false otherwise.
+ */
+typedef bool (*ezb_mac_capture_write_t)(const void *data, size_t length, void *ctx);
+
+/**
+ * @brief Configuration of the frame capture
+ *
+ * The frames exchanged with the radio are copied, with their timestamp, RSSI, LQI and channel, into a single producer
+ * single consumer ring of @p ring_size slots, without lock. A task of priority @p task_priority drains the ring and
+ * writes a pcapng stream of link type IEEE 802.15.4 TAP (283) to @p write, which may write to a file, a UART or a
+ * socket. The stream starts with the section header and interface description blocks, followed by one enhanced packet
+ * block per frame, without FCS. The timestamps are those of the radio, in microseconds.
+ *
+ * The received frames are captured before any filtering, so the frames dropped before the stack, e.g. as replays,
+ * appear in the stream. With @p promiscuous, the frames exchanged between other devices are captured as well, they
+ * are passed on to the stack but kept out of the statistics and the other frame observers.
+ *
+ * A frame that does not fit in the ring is dropped and counted, the stack is never slowed down by the capture.
+ */
+typedef struct ezb_mac_capture_config_s {
+    uint16_t ring_size;             /*!< The number of frames the ring holds, a power of 2. */
+    bool promiscuous;               /*!< Put the radio in promiscuous mode while capturing. */
+    bool transmitted;               /*!< Capture the frames transmitted by this device too. */
+    uint8_t task_priority;          /*!< The priority of the capture task, lower than the Zigbee task. */
+    uint32_t task_stack_size;       /*!< The stack size of the capture task, in bytes. */
+    ezb_mac_capture_write_t write;  /*!< The output of the pcapng stream. */
+    void *ctx;                      /*!< The user context passed to @p write. */
+} ezb_mac_capture_config_t;
+
+/**
+ * @brief Statistics of the frame capture
+ */
+typedef struct ezb_mac_capture_stats_s {
+    uint32_t captured;     /*!< Number of frames put into the ring. */
+    uint32_t dropped;      /*!< Number of frames dropped because the ring was full. */
+    uint32_t written;      /*!< Number of frames written to the output. */
+    uint32_t write_errors; /*!< Number of frames lost because the output failed. */
+} ezb_mac_capture_stats_t;
+
+/**
+ * @brief Start the frame capture.
+ *
+ * @param[in] config The configuration, @ref ezb_mac_capture_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The capture is already started
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_mac_capture_start(const ezb_mac_capture_config_t *config);
+
+/**
+ * @brief Stop the frame capture, the frames left in the ring are written before the capture task exits.
+ */
+void ezb_mac_capture_stop(void);
+
+/**
+ * @brief Get the statistics of the frame capture.
+ *
+ * @param[out] stats The statistics, @ref ezb_mac_capture_stats_s
+ */
+void ezb_mac_capture_get_stats(ezb_mac_capture_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_MAC_CAPTURE_H */
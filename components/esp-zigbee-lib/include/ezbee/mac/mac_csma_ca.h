@@ -0,0 +1,104 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_MAC_CSMA_CA_H
+#define ESP_ZIGBEE_MAC_CSMA_CA_H
+
+#include <ezbee/mac.h>
+#include <ezbee/platform/radio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Traffic classes of the adaptive CSMA-CA controller
+ */
+typedef enum ezb_mac_csma_ca_class_e {
+    EZB_MAC_CSMA_CA_CLASS_UNICAST   = 0, /*!< Data frames sent to a single device, acknowledged. */
+    EZB_MAC_CSMA_CA_CLASS_BROADCAST = 1, /*!< Data frames without acknowledgement, e.g. broadcasts. */
+    EZB_MAC_CSMA_CA_CLASS_COMMAND   = 2, /*!< MAC command frames, e.g. data requests and beacon requests. */
+    EZB_MAC_CSMA_CA_CLASS_MAX_NR,        /*!< Number of traffic classes. */
+} ezb_mac_csma_ca_class_t;
+
+/**
+ * @brief Configuration of the adaptive CSMA-CA controller
+ *
+ * The controller keeps a set of CSMA-CA parameters per channel and per traffic class, starting from the parameters
+ * set with @ref ezb_mac_set_csma_ca_params, and applies them to each transmitted frame. Every @p window transmissions
+ * of a channel and class, the rates of channel access failures and of missing acknowledgements are compared with the
+ * thresholds, in per mille:
+ *
+ *  - Channel access failures above @p busy_high: the channel is busy, the maximum number of backoffs is increased,
+ *    then the maximum backoff exponent.
+ *  - Otherwise, missing acknowledgements above @p collision_high: the frames collide, the minimum backoff exponent is
+ *    increased to spread the transmissions. Each missing acknowledgement causes a MAC retry.
+ *  - Both rates below @p busy_low and @p collision_low: the parameters step back towards the initial ones.
+ *
+ * The parameters are changed by one step per window at most, and are kept between the two thresholds of each rate.
+ * When @ref ezb_mac_set_csma_ca_params is called while the controller runs, every channel and class restarts from the
+ * new parameters.
+ */
+typedef struct ezb_mac_csma_ca_controller_config_s {
+    uint16_t window;         /*!< The number of transmissions between two adjustments. */
+    uint16_t busy_high;      /*!< The channel access failure rate over which the backoffs are extended, per mille. */
+    uint16_t busy_low;       /*!< The channel access failure rate under which the backoffs are reduced, per mille. */
+    uint16_t collision_high; /*!< The missing acknowledgement rate over which the minimum BE is raised, per mille. */
+    uint16_t collision_low;  /*!< The missing acknowledgement rate under which the minimum BE is lowered, per mille. */
+} ezb_mac_csma_ca_controller_config_t;
+
+/**
+ * @brief Statistics of the adaptive CSMA-CA controller for a channel and a traffic class
+ */
+typedef struct ezb_mac_csma_ca_controller_stats_s {
+    ezb_mac_csma_ca_params_t params; /*!< The CSMA-CA parameters currently applied. */
+    uint32_t frames;                 /*!< Number of completed transmissions. */
+    uint32_t access_failures;        /*!< Number of channel access failures. */
+    uint32_t no_acks;                /*!< Number of transmissions without acknowledgement. */
+    uint32_t increases;              /*!< Number of times the backoffs were extended. */
+    uint32_t decreases;              /*!< Number of times the backoffs were reduced. */
+} ezb_mac_csma_ca_controller_stats_t;
+
+/**
+ * @brief Initialize the adaptive CSMA-CA controller.
+ *
+ * @param[in] config The configuration, @ref ezb_mac_csma_ca_controller_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The controller is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_mac_csma_ca_controller_init(const ezb_mac_csma_ca_controller_config_t *config);
+
+/**
+ * @brief Deinitialize the adaptive CSMA-CA controller, the frames are sent with the parameters of the stack again.
+ */
+void ezb_mac_csma_ca_controller_deinit(void);
+
+/**
+ * @brief Get the statistics of the adaptive CSMA-CA controller for a channel and a traffic class.
+ *
+ * @param[in]  channel The channel, from EZB_RADIO_2P4GHZ_CHANNEL_MIN to EZB_RADIO_2P4GHZ_CHANNEL_MAX.
+ * @param[in]  cls     The traffic class, @ref ezb_mac_csma_ca_class_e
+ * @param[out] stats   The statistics, @ref ezb_mac_csma_ca_controller_stats_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_INV_STATE: The controller is not initialized
+ */
+ezb_err_t ezb_mac_csma_ca_controller_get_stats(uint8_t channel, ezb_mac_csma_ca_class_t cls,
+                                               ezb_mac_csma_ca_controller_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_MAC_CSMA_CA_H */
@@ -0,0 +1,60 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_MAC_STATS_H
+#define ESP_ZIGBEE_MAC_STATS_H
+
+#include <ezbee/mac.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief MAC layer counters
+ *
+ * The counters are kept with the NWK and APS counters in a single structure, and are only updated in the Zigbee task
+ * context, so a call of @ref ezb_mac_get_stats from the Zigbee task returns a consistent snapshot.
+ */
+typedef struct ezb_mac_stats_s {
+    uint32_t tx_ucast;       /*!< Number of unicast frames transmitted, the retries are not included. */
+    uint32_t tx_bcast;       /*!< Number of broadcast frames transmitted. */
+    uint32_t rx_ucast;       /*!< Number of unicast frames received. */
+    uint32_t rx_bcast;       /*!< Number of broadcast frames received. */
+    uint32_t tx_ucast_retry; /*!< Number of retransmissions of unicast frames. */
+    uint32_t tx_ucast_fail;  /*!< Number of unicast frames not delivered after the last retry. */
+    uint32_t cca_failures;   /*!< Number of transmissions that failed with a channel access failure. */
+    uint32_t ack_timeouts;   /*!< Number of transmissions without acknowledgement. */
+    int8_t   last_rssi;      /*!< RSSI of the last received frame, in dBm. */
+    uint8_t  last_lqi;       /*!< LQI of the last received frame. */
+} ezb_mac_stats_t;
+
+/**
+ * @brief Enable or disable the MAC layer counters.
+ *
+ * @param[in] enable Whether the counters are updated, the counters keep their values when disabled.
+ */
+void ezb_mac_stats_enable(bool enable);
+
+/**
+ * @brief Get a snapshot of the MAC layer counters.
+ *
+ * @param[out] stats The counters, @ref ezb_mac_stats_s
+ */
+void ezb_mac_get_stats(ezb_mac_stats_t *stats);
+
+/**
+ * @brief Reset the MAC layer counters to zero.
+ */
+void ezb_mac_reset_stats(void);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_MAC_STATS_H */
@@ -473,6 +473,99 @@ ezb_err_t ezb_nwk_get_next_route(ezb_nwk_info_iterator_t *iterator, ezb_nwk_rout
  */
 ezb_err_t ezb_nwk_get_next_route_record(ezb_nwk_info_iterator_t *iterator, ezb_nwk_route_record_info_t *route_record_info);
 
+/**
+ * @brief  Copy all active entries of the neighbor table into a buffer in one pass
+ *
+ * @note The whole table is copied within a single call, so the Zigbee lock only needs to be held for one table walk.
+ *
+ * @param[out]   table      buffer to store the neighbor entries, @ref ezb_nwk_neighbor_info_s
+ * @param[inout] count      capacity of @p table in entries on input, number of copied entries on output
+ * @param[out]   generation generation of the neighbor table after the copy, can be NULL,
+ *                          refer to @ref ezb_nwk_get_neighbor_table_generation
+ *
+ * @return - EZB_ERR_NONE on success
+ *         - EZB_ERR_INV_SIZE if @p table is too small, the first @p count entries are copied
+ *         - EZB_ERR_INV_ARG if arguments are invalid
+ *
+ */
+ezb_err_t ezb_nwk_get_neighbor_table(ezb_nwk_neighbor_info_t *table, uint16_t *count, uint32_t *generation);
+
+/**
+ * @brief  Copy all entries of the routing table into a buffer in one pass
+ *
+ * @param[out]   table      buffer to store the route entries, @ref ezb_nwk_route_info_s
+ * @param[inout] count      capacity of @p table in entries on input, number of copied entries on output
+ * @param[out]   generation generation of the routing table after the copy, can be NULL,
+ *                          refer to @ref ezb_nwk_get_route_table_generation
+ *
+ * @return - EZB_ERR_NONE on success
+ *         - EZB_ERR_INV_SIZE if @p table is too small, the first @p count entries are copied
+ *         - EZB_ERR_INV_ARG if arguments are invalid
+ *
+ */
+ezb_err_t ezb_nwk_get_route_table(ezb_nwk_route_info_t *table, uint16_t *count, uint32_t *generation);
+
+/**
+ * @brief  Copy all entries of the route record table into a buffer in one pass
+ *
+ * @param[out]   table      buffer to store the route record entries, @ref ezb_nwk_route_record_info_s
+ * @param[inout] count      capacity of @p table in entries on input, number of copied entries on output
+ * @param[out]   generation generation of the route record table after the copy, can be NULL,
+ *                          refer to @ref ezb_nwk_get_route_record_table_generation
+ *
+ * @return - EZB_ERR_NONE on success
+ *         - EZB_ERR_INV_SIZE if @p table is too small, the first @p count entries are copied
+ *         - EZB_ERR_INV_ARG if arguments are invalid
+ *
+ */
+ezb_err_t ezb_nwk_get_route_record_table(ezb_nwk_route_record_info_t *table, uint16_t *count, uint32_t *generation);
+
+/**
+ * @brief  Get the generation of the neighbor table
+ *
+ * The generation increases whenever the topology described by the table changes: an entry is added or removed, or
+ * the address, device type, relationship, depth or RxOnWhenIdle of an entry changes. Fields that drift with every
+ * received frame (LQI, RSSI, costs and aging counters) do not affect the generation, so a poller can skip the
+ * snapshot entirely when the generation is unchanged.
+ *
+ * @note The generation is evaluated against the previous query or snapshot, it does not copy any entry. From the
+ *       first query on, the frames and signals that may change the tables are observed: the table is only walked
+ *       and hashed, O(n) in the number of entries, after such an event, or when the last walk is older than 15
+ *       seconds since the stack also ages the entries out on its own. Otherwise the query returns at once.
+ *
+ * @return The generation of the neighbor table
+ *
+ */
+uint32_t ezb_nwk_get_neighbor_table_generation(void);
+
+/**
+ * @brief  Get the generation of the routing table
+ *
+ * The generation increases whenever an entry is added or removed, or the next hop, state or flags of an entry
+ * change. The expiry counter and the reserved and deprecated flags do not affect the generation.
+ *
+ * @note As for @ref ezb_nwk_get_neighbor_table_generation, the table is only walked after an event that may change
+ *       it, or when the last walk is older than 15 seconds.
+ *
+ * @return The generation of the routing table
+ *
+ */
+uint32_t ezb_nwk_get_route_table_generation(void);
+
+/**
+ * @brief  Get the generation of the route record table
+ *
+ * The generation increases whenever an entry is added or removed, or the relay path of an entry changes.
+ * The expiry counter does not affect the generation.
+ *
+ * @note As for @ref ezb_nwk_get_neighbor_table_generation, the table is only walked after an event that may change
+ *       it, or when the last walk is older than 15 seconds.
+ *
+ * @return The generation of the route record table
+ *
+ */
+uint32_t ezb_nwk_get_route_record_table_generation(void);
+
 /**
  * @brief  Get the nwkLinkStatusPeriod attribute in NIB
  *
@@ -491,6 +584,44 @@ uint8_t ezb_nwk_get_link_status_period(void);
  */
 ezb_err_t ezb_nwk_set_link_status_period(uint8_t period);
 
+/**
+ * @brief  Start the concentrator mode of the device, a router or the coordinator
+ *
+ * Once started, the stack sends a many-to-one route request about every second until @p disc_time requests have
+ * been skipped, that is every @p disc_time + 1 seconds, or sooner when requested by
+ * @ref ezb_nwk_concentrator_discovery. A discovery time of 0 sends a request every second.
+ *
+ * @param[in] radius       The radius of the many-to-one route requests.
+ * @param[in] disc_sp_time The seconds a request by @ref ezb_nwk_concentrator_discovery is held back, at most
+ *                         @p disc_time.
+ * @param[in] disc_time    The seconds between two periodic many-to-one route requests, minus one.
+ *
+ * @return - EZB_ERR_NONE on success
+ *         - EZB_ERR_INV_ARG if @p disc_sp_time is larger than @p disc_time
+ *         - EZB_ERR_NOT_SUPPORTED if the device is not a router or the coordinator
+ *
+ */
+ezb_err_t ezb_nwk_concentrator_start(uint8_t radius, uint8_t disc_sp_time, uint8_t disc_time);
+
+/**
+ * @brief  Stop the concentrator mode of the device
+ *
+ * @return - EZB_ERR_NONE on success
+ *         - EZB_ERR_NOT_SUPPORTED if the device is not a router or the coordinator
+ *
+ */
+ezb_err_t ezb_nwk_concentrator_stop(void);
+
+/**
+ * @brief  Request a many-to-one route request, the periodic requests restart from it
+ *
+ * @return - EZB_ERR_NONE on success
+ *         - EZB_ERR_INV_STATE if the concentrator mode is not started
+ *         - EZB_ERR_NOT_SUPPORTED if the device is not a router or the coordinator
+ *
+ */
+ezb_err_t ezb_nwk_concentrator_discovery(void);
+
 /**
  * @brief  Get the minimum LQI value for device joining the network
  *
@@ -604,4 +735,15 @@ ezb_err_t ezb_nwk_scan(const ezb_nwk_scan_req_t *req);
 } /*  extern "C" */
 #endif
 
+#include <ezbee/nwk/nwk_concentrator.h>
+#include <ezbee/nwk/nwk_broadcast.h>
+#include <ezbee/nwk/nwk_link_estimator.h>
+#include <ezbee/nwk/nwk_link_status.h>
+#include <ezbee/nwk/nwk_channel_manager.h>
+#include <ezbee/nwk/nwk_fast_scan.h>
+#include <ezbee/nwk/nwk_fast_rejoin.h>
+#include <ezbee/nwk/nwk_frame_counter.h>
+#include <ezbee/nwk/nwk_replay.h>
+#include <ezbee/nwk/nwk_stats.h>
+
 #endif /* ESP_ZIGBEE_NWK_H */
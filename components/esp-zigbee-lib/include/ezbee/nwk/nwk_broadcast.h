@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_NWK_BROADCAST_H
+#define ESP_ZIGBEE_NWK_BROADCAST_H
+
+#include <ezbee/nwk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the broadcast transaction table
+ *
+ * Every broadcast relayed or originated by the device is tracked by its source address and sequence number. The
+ * table records which router neighbors have been heard relaying the broadcast (passive acknowledgement), and the
+ * retransmissions of the broadcast are suppressed once all of them have relayed it.
+ *
+ * The relay of broadcasts can also be limited per originator with a token bucket, so a single device flooding the
+ * network cannot take the channel from the unicast traffic. The route requests are not rate limited, the route
+ * discovery of the unicast traffic depends on them.
+ *
+ * An entry lives for @p entry_timeout from the first time its broadcast is heard or sent, a broadcast is not tracked
+ * while all the entries are in use.
+ */
+typedef struct ezb_nwk_btt_config_s {
+    uint16_t size;          /*!< The number of entries in the broadcast transaction table, below 65535. */
+    uint16_t entry_timeout; /*!< The lifetime of an entry, in milliseconds. The broadcast delivery time of the
+                                 network should be used, which is 9000 milliseconds by default. */
+    uint8_t rate_limit;     /*!< The number of broadcasts relayed per second for a single originator, 0 to disable
+                                 the rate limiting. */
+    uint8_t rate_burst;     /*!< The number of broadcasts of a single originator relayed back to back before the
+                                 rate limiting applies. */
+} ezb_nwk_btt_config_t;
+
+/**
+ * @brief Statistics of the broadcast transaction table
+ */
+typedef struct ezb_nwk_btt_stats_s {
+    uint16_t size;              /*!< The number of entries in the table. */
+    uint16_t used;              /*!< The number of entries currently in use. */
+    uint16_t high_water;        /*!< The maximum number of entries used at the same time. */
+    uint32_t broadcasts;        /*!< Number of broadcasts originated by the device, retransmissions excluded. */
+    uint32_t rebroadcasts;      /*!< Number of broadcasts relayed by the device, retransmissions excluded. */
+    uint32_t retransmissions;   /*!< Number of retransmissions of the broadcasts tracked in the table. */
+    uint32_t suppressed;        /*!< Number of retransmissions suppressed by passive acknowledgement. */
+    uint32_t rate_limited;      /*!< Number of relays dropped by the rate limiting of their originator. */
+    uint32_t table_full;        /*!< Number of broadcasts not tracked because the table was full. */
+} ezb_nwk_btt_stats_t;
+
+/**
+ * @brief Initialize the broadcast transaction table with passive acknowledgement tracking.
+ *
+ * @param[in] config The configuration of the table, @ref ezb_nwk_btt_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The table is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory for the table
+ */
+ezb_err_t ezb_nwk_btt_init(const ezb_nwk_btt_config_t *config);
+
+/**
+ * @brief Deinitialize the broadcast transaction table and release its memory.
+ */
+void ezb_nwk_btt_deinit(void);
+
+/**
+ * @brief Get the statistics of the broadcast transaction table.
+ *
+ * @param[out] stats The statistics, @ref ezb_nwk_btt_stats_s
+ */
+void ezb_nwk_btt_get_stats(ezb_nwk_btt_stats_t *stats);
+
+/**
+ * @brief Reset the counters of the broadcast transaction table statistics.
+ */
+void ezb_nwk_btt_reset_stats(void);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_NWK_BROADCAST_H */
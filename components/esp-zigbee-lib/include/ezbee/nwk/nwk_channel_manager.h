@@ -0,0 +1,108 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_NWK_CHANNEL_MANAGER_H
+#define ESP_ZIGBEE_NWK_CHANNEL_MANAGER_H
+
+#include <ezbee/nwk.h>
+#include <ezbee/platform/radio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the channel manager
+ *
+ * Every @p check_interval, the manager computes the MAC transmission failure ratio of the acknowledged unicast
+ * frames sent by the device, a frame fails on no acknowledgement or on channel access failure. A window with at least
+ * @p min_tx_frames frames and a failure ratio of @p failure_threshold percent or more is suspect.
+ *
+ * After @p confirm_checks consecutive suspect windows, the manager surveys the channels of @p channel_mask: an energy
+ * detection scan on the device, then a Mgmt_NWK_Update_req energy scan polled from up to @p max_reports router
+ * neighbors, one at a time. The energy of a channel is the highest one reported for it by any device.
+ *
+ * The network moves to the quietest channel only if its energy is at least @p hysteresis dB below the energy of the
+ * current channel, and at least @p holdoff seconds after the previous change.
+ */
+typedef struct ezb_nwk_channel_manager_config_s {
+    uint32_t channel_mask;      /*!< The candidate channels, bitmask of the 2.4 GHz channels. */
+    uint16_t check_interval;    /*!< The length of the failure ratio window, in seconds. */
+    uint16_t min_tx_frames;     /*!< The minimum number of frames in a window to evaluate its failure ratio. */
+    uint8_t  failure_threshold; /*!< The failure ratio of a suspect window, in percent, 1 to 100. */
+    uint8_t  confirm_checks;    /*!< The number of consecutive suspect windows that trigger a survey. */
+    uint8_t  scan_duration;     /*!< The energy scan duration of each channel, 0 to 5, see @ref ezb_nwk_scan_req_s. */
+    uint8_t  max_reports;       /*!< The maximum number of router neighbors polled for energy reports in a survey. */
+    uint8_t  hysteresis;        /*!< The energy margin of the new channel over the current one, in dB. */
+    uint16_t holdoff;           /*!< The minimum time between two channel changes, in seconds. */
+} ezb_nwk_channel_manager_config_t;
+
+/**
+ * @brief Statistics of the channel manager
+ */
+typedef struct ezb_nwk_channel_manager_stats_s {
+    uint32_t tx_frames;          /*!< Number of acknowledged unicast frames sent in the last complete window. */
+    uint32_t tx_failures;        /*!< Number of those frames that failed. */
+    uint32_t suspect_windows;    /*!< Number of suspect windows. */
+    uint32_t surveys;            /*!< Number of channel surveys. */
+    uint32_t reports;            /*!< Number of Mgmt_NWK_Update_notify reports received from routers. */
+    uint32_t report_tx_total;    /*!< Sum of the total transmissions of the received reports. */
+    uint32_t report_tx_failures; /*!< Sum of the transmission failures of the received reports. */
+    uint32_t channel_changes;    /*!< Number of channel changes requested. */
+    uint8_t  last_channel;       /*!< The channel before the last change, 0 if there is none. */
+    int8_t   energy[EZB_RADIO_2P4GHZ_CHANNEL_MAX - EZB_RADIO_2P4GHZ_CHANNEL_MIN + 1];
+                                 /*!< Energy of the channels 11 to 26 in the last survey, in dBm, INT8_MIN if not
+                                      surveyed. */
+} ezb_nwk_channel_manager_stats_t;
+
+/**
+ * @brief Initialize the channel manager.
+ *
+ * @note Surveys and channel changes only run while the device is the coordinator of a formed network, which acts as
+ *       the network manager. The channel change is a broadcast Mgmt_NWK_Update_req with the new channel and an
+ *       incremented nwkUpdateId, the whole network including the coordinator moves to the new channel.
+ *
+ * @param[in] config The configuration, @ref ezb_nwk_channel_manager_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The channel manager is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_nwk_channel_manager_init(const ezb_nwk_channel_manager_config_t *config);
+
+/**
+ * @brief Deinitialize the channel manager, a survey in progress is abandoned.
+ */
+void ezb_nwk_channel_manager_deinit(void);
+
+/**
+ * @brief Start a channel survey now, regardless of the failure ratio.
+ *
+ * @note The survey may still end with a channel change, under the same hysteresis and holdoff.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_STATE: The channel manager is not initialized or the device is not the coordinator
+ *      - EZB_ERR_BUSY: A survey is already in progress
+ */
+ezb_err_t ezb_nwk_channel_manager_survey(void);
+
+/**
+ * @brief Get the statistics of the channel manager.
+ *
+ * @param[out] stats The statistics, @ref ezb_nwk_channel_manager_stats_s
+ */
+void ezb_nwk_channel_manager_get_stats(ezb_nwk_channel_manager_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_NWK_CHANNEL_MANAGER_H */
@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_NWK_CONCENTRATOR_H
+#define ESP_ZIGBEE_NWK_CONCENTRATOR_H
+
+#include <ezbee/nwk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the adaptive many-to-one route request scheduling
+ *
+ * The interval between two many-to-one route requests (MTORR) starts at @p min_interval and doubles after every
+ * request that leaves the route record table unchanged, up to @p max_interval. A route error, a device
+ * (re)joining or a device becoming unavailable resets the interval to @p min_interval and triggers a request after
+ * @p holdoff, so that a burst of events is answered by a single request.
+ */
+typedef struct ezb_nwk_concentrator_adaptive_config_s {
+    uint8_t  radius;       /*!< The radius of the many-to-one route requests, 0 for the default of 30. */
+    uint16_t min_interval; /*!< The shortest interval between two requests, in seconds. */
+    uint16_t max_interval; /*!< The longest interval between two requests, in seconds, at most 240. */
+    uint16_t holdoff;      /*!< The delay of a request triggered by topology events, in seconds. */
+} ezb_nwk_concentrator_adaptive_config_t;
+
+/**
+ * @brief Statistics of the adaptive many-to-one route request scheduling
+ */
+typedef struct ezb_nwk_concentrator_stats_s {
+    uint32_t mtorr_count;          /*!< Number of many-to-one route requests sent. */
+    uint32_t mtorr_triggered;      /*!< Number of requests sent early because of topology events. */
+    uint32_t route_errors;         /*!< Number of route errors reported by Network Status commands. */
+    uint32_t joins;                /*!< Number of devices joined or rejoined. */
+    uint32_t unavailable;          /*!< Number of devices reported unavailable. */
+    uint32_t route_record_changes; /*!< Number of requests after which the route record table changed. */
+    uint16_t route_records;        /*!< Number of entries in the route record table at the last request. */
+    uint16_t interval;             /*!< The current interval between two requests, in seconds. */
+} ezb_nwk_concentrator_stats_t;
+
+/**
+ * @brief Start the concentrator with the adaptive many-to-one route request scheduling.
+ *
+ * @note The first request is sent immediately.
+ * @note The periodic requests of the stack cannot be disabled. The concentrator is started with the longest discovery
+ *       time, about 255 seconds, and each request of this scheduling restarts that period, so that the stack sends
+ *       none of its own.
+ *
+ * @param[in] config The configuration of the scheduling, @ref ezb_nwk_concentrator_adaptive_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The adaptive scheduling is already started
+ *      - EZB_ERR_NO_MEM: Not enough resources for the scheduling
+ *      - Others: The error returned when starting the concentrator
+ */
+ezb_err_t ezb_nwk_concentrator_adaptive_start(const ezb_nwk_concentrator_adaptive_config_t *config);
+
+/**
+ * @brief Stop the adaptive many-to-one route request scheduling and the concentrator.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_STATE: The adaptive scheduling is not started
+ */
+ezb_err_t ezb_nwk_concentrator_adaptive_stop(void);
+
+/**
+ * @brief Get the statistics of the adaptive many-to-one route request scheduling.
+ *
+ * @param[out] stats The statistics, @ref ezb_nwk_concentrator_stats_s
+ */
+void ezb_nwk_concentrator_get_stats(ezb_nwk_concentrator_stats_t *stats);
+
+/**
+ * @brief Reset the statistics of the adaptive many-to-one route request scheduling.
+ */
+void ezb_nwk_concentrator_reset_stats(void);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_NWK_CONCENTRATOR_H */
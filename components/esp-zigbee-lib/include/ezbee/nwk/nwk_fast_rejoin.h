@@ -0,0 +1,109 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_NWK_FAST_REJOIN_H
+#define ESP_ZIGBEE_NWK_FAST_REJOIN_H
+
+#include <ezbee/nwk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Enumeration of the fast rejoin stages
+ * @anchor ezb_nwk_fast_rejoin_stage_e
+ */
+enum ezb_nwk_fast_rejoin_stage_e {
+    EZB_NWK_FAST_REJOIN_STAGE_CACHED = 0,    /*!< Secured rejoin on the stored channel of the network */
+    EZB_NWK_FAST_REJOIN_STAGE_RESTRICTED,    /*!< Secured rejoin on the restricted channels */
+    EZB_NWK_FAST_REJOIN_STAGE_FULL,          /*!< Secured rejoin on the whole channel mask */
+    EZB_NWK_FAST_REJOIN_STAGE_MAX_NR,        /*!< Maximum number of stages */
+};
+
+/**
+ * @brief Represent the fast rejoin stage, see @ref ezb_nwk_fast_rejoin_stage_e
+ */
+typedef uint8_t ezb_nwk_fast_rejoin_stage_t;
+
+/**
+ * @brief Result of a fast rejoin
+ */
+typedef struct ezb_nwk_fast_rejoin_result_s {
+    ezb_err_t error;                   /*!< EZB_ERR_NONE if the device is back on the network, EZB_ERR_FAIL if every
+                                            stage failed. */
+    ezb_nwk_fast_rejoin_stage_t stage; /*!< The last stage tried. */
+    uint8_t channel;                   /*!< The channel of the network, 0 on failure. */
+    uint32_t rejoin_time;              /*!< Time from the start to the completion of the rejoin, in milliseconds. */
+    uint32_t first_packet_time;        /*!< Time from the start to the first data frame acknowledged by another
+                                            device, in milliseconds, 0 on failure or if no data frame was
+                                            acknowledged within the first packet timeout. */
+} ezb_nwk_fast_rejoin_result_t;
+
+/**
+ * @brief Callback of the fast rejoin result
+ *
+ * @param[in] result   The result, @ref ezb_nwk_fast_rejoin_result_s
+ * @param[in] user_ctx The user context
+ */
+typedef void (*ezb_nwk_fast_rejoin_callback_t)(const ezb_nwk_fast_rejoin_result_t *result, void *user_ctx);
+
+/**
+ * @brief Configuration of the fast rejoin
+ *
+ * The BDB initialization of a device that is not factory new rejoins the network stored in the datasets, scanning
+ * for it on the whole channel mask. The fast rejoin runs the BDB initialization in up to three stages, narrowing the
+ * channel mask of each stage:
+ * - The stored channel only, where the stored parent is expected.
+ * - The @p restricted_channels, the BDB primary channel set if zero.
+ * - The channel mask in use when the fast rejoin was started.
+ *
+ * The channel mask and the BDB scan duration are restored when the fast rejoin completes.
+ */
+typedef struct ezb_nwk_fast_rejoin_config_s {
+    uint32_t restricted_channels;      /*!< The channels of the restricted stage, bitmask of the 2.4 GHz channels. */
+    uint8_t cached_scan_duration;      /*!< The BDB scan duration of the cached stage, see
+                                            @ref ezb_bdb_set_scan_duration. */
+    uint16_t first_packet_timeout;     /*!< The time allowed after the rejoin for a data frame to be acknowledged, in
+                                            milliseconds, 0 for the default of 5000. */
+    ezb_nwk_fast_rejoin_callback_t cb; /*!< Callback of the result, called once the first data frame is
+                                            acknowledged, at the first packet timeout, or when every stage failed.
+                                            MAC commands such as data polls are not taken as the first frame. */
+    void *user_ctx;                    /*!< The user context for the callback function. */
+} ezb_nwk_fast_rejoin_config_t;
+
+/**
+ * @brief Start the fast rejoin, in place of the BDB initialization.
+ *
+ * @note Typically called on EZB_ZDO_SIGNAL_SKIP_STARTUP. The EZB_BDB_SIGNAL_DEVICE_REBOOT signals are still raised
+ *       for each stage, the application must not restart the BDB initialization on failure while the fast rejoin is
+ *       in progress, see @ref ezb_nwk_fast_rejoin_in_progress.
+ *
+ * @param[in] config The configuration, @ref ezb_nwk_fast_rejoin_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The device is factory new or has no stored channel
+ *      - EZB_ERR_BUSY: A fast rejoin is already in progress
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_nwk_fast_rejoin_start(const ezb_nwk_fast_rejoin_config_t *config);
+
+/**
+ * @brief Check whether a fast rejoin is in progress.
+ *
+ * @return true if a fast rejoin is in progress, false otherwise.
+ */
+bool ezb_nwk_fast_rejoin_in_progress(void);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_NWK_FAST_REJOIN_H */
@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_NWK_FAST_SCAN_H
+#define ESP_ZIGBEE_NWK_FAST_SCAN_H
+
+#include <ezbee/nwk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Enumeration of the beacon criteria that terminate a fast scan
+ * @anchor ezb_nwk_fast_scan_match_e
+ */
+enum ezb_nwk_fast_scan_match_e {
+    EZB_NWK_FAST_SCAN_MATCH_EXTPANID        = 0x01U, /*!< The extended PAN ID equals the requested one */
+    EZB_NWK_FAST_SCAN_MATCH_PERMIT_JOIN     = 0x02U, /*!< The beacon sender permits joining */
+    EZB_NWK_FAST_SCAN_MATCH_ROUTER_CAPACITY = 0x04U, /*!< The beacon sender accepts routers */
+    EZB_NWK_FAST_SCAN_MATCH_ENDDEV_CAPACITY = 0x08U, /*!< The beacon sender accepts end devices */
+};
+
+/**
+ * @brief Represent the beacon criteria of a fast scan, bitmask of @ref ezb_nwk_fast_scan_match_e
+ */
+typedef uint8_t ezb_nwk_fast_scan_match_t;
+
+/**
+ * @brief Request for fast active scan
+ *
+ * The channels are scanned one at a time: first the channel of the last beacon matched by a fast scan, then the
+ * @p hint_channels in order, then the other channels of @p scan_channels in ascending order. Every beacon is reported
+ * through @p active_scan_cb as soon as it is received.
+ *
+ * The scan terminates at the end of the first channel where a beacon meets all the criteria of @p match, the
+ * remaining channels are not scanned. With no criteria, all the channels are scanned.
+ */
+typedef struct ezb_nwk_fast_scan_req_s {
+    uint8_t scan_duration;                         /*!< Scan duration of each channel, see @ref ezb_nwk_scan_req_s. */
+    uint32_t scan_channels;                        /*!< Scan channels, bitmask of the channels to scan. */
+    const uint8_t *hint_channels;                  /*!< Channels to scan first, in order, may be NULL. */
+    uint8_t hint_count;                            /*!< Number of the hint channels. */
+    ezb_nwk_fast_scan_match_t match;               /*!< The criteria that terminate the scan. */
+    ezb_extpanid_t extpanid;                       /*!< The extended PAN ID of EZB_NWK_FAST_SCAN_MATCH_EXTPANID. */
+    ezb_nwk_active_scan_callback_t active_scan_cb; /*!< Callback of every beacon, called with NULL when the scan
+                                                        finishes. */
+    void *user_ctx;                                /*!< The user context for the callback function. */
+} ezb_nwk_fast_scan_req_t;
+
+/**
+ * @brief Start a fast active scan.
+ *
+ * @param[in] req The fast scan request, @ref ezb_nwk_fast_scan_req_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid request, or no channel to scan
+ *      - EZB_ERR_BUSY: A fast scan is already in progress
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ *      - Other error codes of @ref ezb_nwk_scan
+ */
+ezb_err_t ezb_nwk_fast_scan(const ezb_nwk_fast_scan_req_t *req);
+
+/**
+ * @brief Set the channel scanned first by the next fast scans.
+ *
+ * @note The hint is updated by every fast scan that matches a beacon. Setting it is useful after a reboot, with the
+ *       channel of the stored network.
+ *
+ * @param[in] channel The channel, 0 to clear the hint.
+ */
+void ezb_nwk_fast_scan_set_hint(uint8_t channel);
+
+/**
+ * @brief Get the channel scanned first by the next fast scans.
+ *
+ * @return The channel, 0 if there is no hint.
+ */
+uint8_t ezb_nwk_fast_scan_get_hint(void);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_NWK_FAST_SCAN_H */
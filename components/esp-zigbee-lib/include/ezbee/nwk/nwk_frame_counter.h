@@ -0,0 +1,94 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_NWK_FRAME_COUNTER_H
+#define ESP_ZIGBEE_NWK_FRAME_COUNTER_H
+
+#include <ezbee/nwk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the outgoing frame counter windows
+ *
+ * The stack stores the outgoing network frame counter in the EZB_DATASETS_KEY_NIB_CNTR dataset as it advances. With
+ * the counter windows, a stored value reserves the next @p window values: the dataset is only written once the counter
+ * has advanced by half a window since the last write, the other writes are skipped. On boot, the counter jumps to the
+ * end of the reserved window, above any value that may have been used before the reset.
+ *
+ * The stack writes the dataset at its own pace. When a quarter of the window is left before the stored value stops
+ * reserving the counter, the last skipped value is written without waiting for the next write of the stack. The window
+ * must stay the same across reboots, and must be larger than the number of frames the stack sends between two writes
+ * of the dataset, see the max_gap and overruns statistics.
+ */
+typedef struct ezb_nwk_frame_counter_config_s {
+    uint32_t window; /*!< The number of counter values reserved by a write, at least 2. */
+} ezb_nwk_frame_counter_config_t;
+
+/**
+ * @brief Statistics of the outgoing frame counter windows
+ */
+typedef struct ezb_nwk_frame_counter_stats_s {
+    uint32_t window;         /*!< The number of counter values reserved by a write. */
+    uint32_t reserved;       /*!< The end of the reserved window, the counter must stay below. */
+    uint32_t writes;         /*!< Number of writes of the dataset requested by the stack. */
+    uint32_t persisted;      /*!< Number of writes of the dataset forwarded to the storage. */
+    uint32_t skipped;        /*!< Number of writes of the dataset skipped. */
+    uint32_t boot_jump;      /*!< The counter values skipped on boot. */
+    uint32_t forced;         /*!< Number of skipped values written as the counter neared the end of the window. */
+    uint32_t overruns;       /*!< Number of times the counter left the window before the stack wrote the dataset. */
+    uint32_t max_gap;        /*!< The largest counter advance observed between two writes requested by the stack. */
+} ezb_nwk_frame_counter_stats_t;
+
+/**
+ * @brief Initialize the outgoing frame counter windows.
+ *
+ * @note Must be called once the datasets are loaded and before any secured frame is sent, typically on
+ *       EZB_ZDO_SIGNAL_SKIP_STARTUP before the BDB initialization. The device may already be joined to the network
+ *       restored from the datasets. If the device is not factory new, the counter jumps to the end of the window
+ *       reserved by the last stored value.
+ *
+ * @param[in] config The configuration, @ref ezb_nwk_frame_counter_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The windows are already initialized or a secured frame has already been sent
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_nwk_frame_counter_window_init(const ezb_nwk_frame_counter_config_t *config);
+
+/**
+ * @brief Deinitialize the outgoing frame counter windows, the last skipped write is flushed.
+ */
+void ezb_nwk_frame_counter_window_deinit(void);
+
+/**
+ * @brief Write the last skipped value of the dataset to the storage, e.g. before a controlled reset.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success, or if no write was skipped
+ *      - EZB_ERR_INV_STATE: The windows are not initialized
+ *      - Other error codes of the datasets storage
+ */
+ezb_err_t ezb_nwk_frame_counter_flush(void);
+
+/**
+ * @brief Get the statistics of the outgoing frame counter windows.
+ *
+ * @param[out] stats The statistics, @ref ezb_nwk_frame_counter_stats_s
+ */
+void ezb_nwk_frame_counter_get_stats(ezb_nwk_frame_counter_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_NWK_FRAME_COUNTER_H */
@@ -0,0 +1,111 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_NWK_LINK_ESTIMATOR_H
+#define ESP_ZIGBEE_NWK_LINK_ESTIMATOR_H
+
+#include <ezbee/nwk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the link estimator
+ *
+ * The estimator smooths the LQI and RSSI of every frame received from a neighbor, and the MAC acknowledgement
+ * success ratio of every unicast frame sent to it, with exponentially weighted moving averages. The weight of a new
+ * sample is 1 / 2^smoothing, a larger smoothing gives a steadier but slower estimate.
+ *
+ * The link costs of the router neighbors are written to the neighbor table every @p update_interval, where the stack
+ * uses them for the link status and the route discovery:
+ * - The incoming cost comes from the smoothed LQI.
+ * - The outgoing cost is the one the neighbor reports for this device in its last link status command. The cost in
+ *   the table is kept until one is received. The acknowledgement ratio is only reported, see
+ *   @ref ezb_nwk_link_info_s.
+ *
+ * A published incoming cost only changes when the estimate moves 3/4 of a cost unit away from it, so a link close to
+ * a cost boundary does not flap between two values.
+ */
+typedef struct ezb_nwk_link_estimator_config_s {
+    uint16_t max_neighbors;   /*!< The maximum number of neighbors tracked by the estimator. */
+    uint8_t  lqi_smoothing;   /*!< The smoothing of the LQI and RSSI averages, 1 to 7. */
+    uint8_t  ack_smoothing;   /*!< The smoothing of the acknowledgement ratio average, 1 to 7. */
+    uint16_t update_interval; /*!< The interval between two updates of the link costs, in seconds. */
+} ezb_nwk_link_estimator_config_t;
+
+/**
+ * @brief Smoothed link information of a neighbor
+ */
+typedef struct ezb_nwk_link_info_s {
+    ezb_shortaddr_t short_addr; /*!< Short address (network address) of the neighbor. */
+    uint8_t lqi;                /*!< Smoothed LQI of the frames received from the neighbor. */
+    int8_t rssi;                /*!< Smoothed RSSI of the frames received from the neighbor, in dBm. */
+    uint8_t ack_ratio;          /*!< Smoothed MAC acknowledgement success ratio, 0 to 255 for 0% to 100%. */
+    uint8_t incoming_cost;      /*!< The incoming cost derived from the smoothed LQI, 0 if not known yet. */
+    uint8_t outgoing_cost;      /*!< The outgoing cost reported by the neighbor, 0 if not known yet. */
+    uint32_t rx_frames;         /*!< Number of frames received from the neighbor. */
+    uint32_t tx_frames;         /*!< Number of unicast frames with acknowledgement request sent to the neighbor. */
+    uint32_t tx_acked;          /*!< Number of unicast frames acknowledged by the neighbor. */
+    uint32_t cost_changes;      /*!< Number of times the published incoming or outgoing cost changed. */
+} ezb_nwk_link_info_t;
+
+/**
+ * @brief Initialize the link estimator.
+ *
+ * @note The estimator takes over the link costs of the neighbor table, the stack no longer updates them from the
+ *       LQI of single frames or from the received link status commands.
+ * @note The estimator relies on ezb_cert_set_route_cost_policy() and ezb_nwk_set_neighbor_info(), the
+ *       certification hooks of ezbee/test_utils.h. The route cost policy set by the application is kept, except that
+ *       the stack does not update the link costs until @ref ezb_nwk_link_estimator_deinit restores it.
+ *
+ * @param[in] config The configuration of the estimator, @ref ezb_nwk_link_estimator_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The estimator is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory for the estimator
+ */
+ezb_err_t ezb_nwk_link_estimator_init(const ezb_nwk_link_estimator_config_t *config);
+
+/**
+ * @brief Deinitialize the link estimator and give the link costs back to the stack.
+ */
+void ezb_nwk_link_estimator_deinit(void);
+
+/**
+ * @brief Get the smoothed link information of a neighbor.
+ *
+ * @param[in]  short_addr The short address of the neighbor.
+ * @param[out] info       The link information, @ref ezb_nwk_link_info_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_NOT_FOUND: The neighbor is not tracked by the estimator
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ */
+ezb_err_t ezb_nwk_get_link_info(ezb_shortaddr_t short_addr, ezb_nwk_link_info_t *info);
+
+/**
+ * @brief Iterate through the neighbors tracked by the link estimator.
+ *
+ * @param[in]  iterator Iterator used to iterate through the neighbors, initialized to EZB_NWK_INFO_ITERATOR_INIT.
+ * @param[out] info     Next link information, @ref ezb_nwk_link_info_s
+ *
+ * @return - EZB_ERR_NONE on success
+ *         - EZB_ERR_NOT_FOUND on finish iteration
+ *         - EZB_ERR_INV_ARG if arguments are invalid
+ */
+ezb_err_t ezb_nwk_get_next_link_info(ezb_nwk_info_iterator_t *iterator, ezb_nwk_link_info_t *info);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_NWK_LINK_ESTIMATOR_H */
@@ -0,0 +1,90 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_NWK_LINK_STATUS_H
+#define ESP_ZIGBEE_NWK_LINK_STATUS_H
+
+#include <ezbee/nwk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the adaptive link status period
+ *
+ * The link status period (nwkLinkStatusPeriod) drops to @p min_period on topology churn: a device joining,
+ * rejoining or leaving, a link failure, a new router neighbor, or a router neighbor reporting new costs for its link
+ * to the device in its link status. After @p stable_periods periods without churn, the period doubles, up to
+ * @p max_period.
+ *
+ * The changes made by the device itself are not churn: a router neighbor aging out of the table, or the link costs
+ * rewritten in the neighbor table, e.g. by the link estimator, see @ref ezb_nwk_link_estimator_init. A router
+ * neighbor that ages out is counted once it comes back.
+ *
+ * Router neighbors age by the number of link status periods of the device, and are removed after nwkRouterAgeLimit
+ * (3) periods without a link status from them. The aging is scaled to the slowest period: the age of a router
+ * neighbor heard within the last @p max_period is reset on each period of the device, so that a neighbor running a
+ * longer period than the device is not aged out between two of its link status.
+ */
+typedef struct ezb_nwk_link_status_adaptive_config_s {
+    uint8_t min_period;     /*!< The link status period on topology churn, in seconds. */
+    uint8_t max_period;     /*!< The link status period of a stable mesh, in seconds. */
+    uint8_t stable_periods; /*!< The number of periods without churn before the period doubles. */
+    uint8_t max_neighbors;  /*!< The maximum number of router neighbors tracked, at least the router neighbors of the
+                                 neighbor table. */
+} ezb_nwk_link_status_adaptive_config_t;
+
+/**
+ * @brief Statistics of the adaptive link status period
+ */
+typedef struct ezb_nwk_link_status_stats_s {
+    uint8_t period;              /*!< The current link status period, in seconds. */
+    uint32_t churn_events;       /*!< Number of topology churn events. */
+    uint32_t period_changes;     /*!< Number of changes of the link status period. */
+    uint32_t age_refreshes;      /*!< Number of router neighbor ages reset because frames were received from them. */
+} ezb_nwk_link_status_stats_t;
+
+/**
+ * @brief Start the adaptive link status period.
+ *
+ * @note The period starts at @p min_period. Only available on routers and coordinators.
+ * @note The ages are reset with ezb_nwk_set_neighbor_info(), the certification hook of ezbee/test_utils.h, with the
+ *       incoming cost of the link estimator when it runs, the incoming cost reported by the neighbor otherwise.
+ *
+ * @param[in] config The configuration, @ref ezb_nwk_link_status_adaptive_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The adaptive link status period is already started
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_nwk_link_status_adaptive_start(const ezb_nwk_link_status_adaptive_config_t *config);
+
+/**
+ * @brief Stop the adaptive link status period and restore the period in use before it was started.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_STATE: The adaptive link status period is not started
+ */
+ezb_err_t ezb_nwk_link_status_adaptive_stop(void);
+
+/**
+ * @brief Get the statistics of the adaptive link status period.
+ *
+ * @param[out] stats The statistics, @ref ezb_nwk_link_status_stats_s
+ */
+void ezb_nwk_link_status_get_stats(ezb_nwk_link_status_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_NWK_LINK_STATUS_H */
@@ -0,0 +1,96 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_NWK_REPLAY_H
+#define ESP_ZIGBEE_NWK_REPLAY_H
+
+#include <ezbee/nwk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Configuration of the incoming frame counter table
+ *
+ * The table is an extra filter in front of the stack, which keeps checking the frame counters of its own neighbor
+ * table. It shadows those counters for every device that secured a frame received by this device, keyed by its
+ * extended address, so that the devices that are not or no longer neighbors are covered too. A frame whose counter is
+ * not above the stored one under the same network key is dropped before it reaches the stack.
+ *
+ * A counter is only stored once the MIC of the frame has been checked, so every secured frame costs one extra CCM*
+ * decryption on top of the one of the stack. The key is chosen by the key sequence number of the frame: the current
+ * network key, or the previous one after a key switch. A frame under a key that is not active yet is passed to the
+ * stack unchecked, without counting as a decrypt failure. When the table is full, the least recently used entry among
+ * the candidate slots is evicted.
+ *
+ * Only the NWK frame counters are covered, the APS frame counters of the frames secured with a link key, such as
+ * those exchanged with the trust center, are left to the stack.
+ *
+ * The entry of a device is removed when it joins, rejoins or leaves, so that a device that has been reset is accepted
+ * again.
+ */
+typedef struct ezb_nwk_replay_table_config_s {
+    uint16_t size; /*!< The number of entries of the table, independent of the neighbor table size. */
+} ezb_nwk_replay_table_config_t;
+
+/**
+ * @brief Statistics of the incoming frame counter table
+ */
+typedef struct ezb_nwk_replay_table_stats_s {
+    uint16_t size;       /*!< The number of entries of the table. */
+    uint16_t used;       /*!< The number of used entries. */
+    uint32_t frames;     /*!< Number of secured frames checked. */
+    uint32_t replays;    /*!< Number of frames dropped as replayed. */
+    uint32_t updates;    /*!< Number of counters stored. */
+    uint32_t unverified; /*!< Number of frames passed to the stack without a valid MIC, or under a key not known. */
+    uint32_t evictions;  /*!< Number of entries evicted to make room for another device. */
+} ezb_nwk_replay_table_stats_t;
+
+/**
+ * @brief Initialize the incoming frame counter table.
+ *
+ * @param[in] config The configuration, @ref ezb_nwk_replay_table_config_s
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid configuration
+ *      - EZB_ERR_INV_STATE: The table is already initialized
+ *      - EZB_ERR_NO_MEM: Not enough memory
+ */
+ezb_err_t ezb_nwk_replay_table_init(const ezb_nwk_replay_table_config_t *config);
+
+/**
+ * @brief Deinitialize the incoming frame counter table.
+ */
+void ezb_nwk_replay_table_deinit(void);
+
+/**
+ * @brief Remove the stored incoming frame counter of a device.
+ *
+ * @param[in] ieee_addr The extended address of the device.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_INV_ARG: Invalid arguments
+ *      - EZB_ERR_NOT_FOUND: The device has no entry
+ */
+ezb_err_t ezb_nwk_replay_table_remove(const ezb_extaddr_t *ieee_addr);
+
+/**
+ * @brief Get the statistics of the incoming frame counter table.
+ *
+ * @param[out] stats The statistics, @ref ezb_nwk_replay_table_stats_s
+ */
+void ezb_nwk_replay_table_get_stats(ezb_nwk_replay_table_stats_t *stats);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_NWK_REPLAY_H */
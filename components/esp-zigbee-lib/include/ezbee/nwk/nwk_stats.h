@@ -0,0 +1,57 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#ifndef ESP_ZIGBEE_NWK_STATS_H
+#define ESP_ZIGBEE_NWK_STATS_H
+
+#include <ezbee/nwk.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief NWK layer counters
+ *
+ * The counters are kept with the MAC and APS counters in a single structure, see @ref ezb_mac_stats_s.
+ */
+typedef struct ezb_nwk_stats_s {
+    uint32_t relayed_ucast;          /*!< Number of unicast frames relayed for other devices. */
+    uint32_t decrypt_failures;       /*!< Number of secured frames with an invalid MIC under the network key of their
+                                          key sequence number, counted while the replay protection table is
+                                          initialized. */
+    uint32_t frame_counter_failures; /*!< Number of frames dropped by the replay protection table. */
+} ezb_nwk_stats_t;
+
+/**
+ * @brief Enable or disable the NWK layer counters.
+ *
+ * @note The security counters are updated by the replay protection table, see @ref ezb_nwk_replay_table_init, so
+ *       they also need it to be initialized.
+ *
+ * @param[in] enable Whether the counters are updated, the counters keep their values when disabled.
+ */
+void ezb_nwk_stats_enable(bool enable);
+
+/**
+ * @brief Get a snapshot of the NWK layer counters.
+ *
+ * @param[out] stats The counters, @ref ezb_nwk_stats_s
+ */
+void ezb_nwk_get_stats(ezb_nwk_stats_t *stats);
+
+/**
+ * @brief Reset the NWK layer counters to zero.
+ */
+void ezb_nwk_reset_stats(void);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
+
+#endif /* ESP_ZIGBEE_NWK_STATS_H */
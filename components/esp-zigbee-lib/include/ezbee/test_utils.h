@@ -11,6 +11,7 @@
 #pragma once
 
 #include <ezbee/core.h>
+#include <ezbee/nwk.h>
 
 #ifndef ESP_ZIGBEE_TEST_UTILS_H
 #define ESP_ZIGBEE_TEST_UTILS_H
@@ -31,12 +32,6 @@ ezb_err_t ezb_cert_set_route_cost_policy(bool disable_in_out_cost_updating, bool
 
 ezb_err_t ezb_nwk_set_neighbor_info(uint16_t short_addr, uint8_t age, uint8_t outgoing_cost, uint8_t incoming_cost);
 
-ezb_err_t ezb_nwk_concentrator_start(uint8_t radius, uint8_t disc_sp_time, uint8_t disc_time);
-
-ezb_err_t ezb_nwk_concentrator_stop(void);
-
-ezb_err_t ezb_nwk_concentrator_discovery(void);
-
 void ezb_nwk_route_delete(ezb_shortaddr_t dst_addr);
 
 void ezb_nwk_route_delete_by_link(ezb_shortaddr_t nbr_addr);
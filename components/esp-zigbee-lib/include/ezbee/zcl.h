@@ -16,6 +16,7 @@
 #include <ezbee/zcl/cluster/power_config.h>
 #include <ezbee/zcl/cluster/custom.h>
 #include <ezbee/zcl/cluster/device_temp_config.h>
+#include <ezbee/zcl/cluster/diagnostics.h>
 #include <ezbee/zcl/cluster/dehumidification_control.h>
 #include <ezbee/zcl/cluster/meter_identification.h>
 #include <ezbee/zcl/cluster/occupancy_sensing.h>
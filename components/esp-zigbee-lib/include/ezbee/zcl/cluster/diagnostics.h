@@ -0,0 +1,91 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @file diagnostics.h
+ * @brief ZCL Diagnostics cluster public header file
+ *
+ * This file contains the attribute identifiers of the Diagnostics cluster and the mapping of the stack counters to
+ * them.
+ */
+
+#pragma once
+
+#include <ezbee/zcl/zcl_common.h>
+#include <ezbee/zcl/zcl_desc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Cluster Revision of the diagnostics cluster implementation */
+#define EZB_ZCL_DIAGNOSTICS_CLUSTER_REVISION (3)
+
+/**
+ * @brief Attribute identifiers for the diagnostics server cluster.
+ */
+typedef enum {
+    EZB_ZCL_ATTR_DIAGNOSTICS_NUMBER_OF_RESETS_ID                = 0x0000U, /*!< NumberOfResets attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_PERSISTENT_MEMORY_WRITES_ID        = 0x0001U, /*!< PersistentMemoryWrites attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_MAC_RX_BCAST_ID                    = 0x0100U, /*!< MacRxBcast attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_MAC_TX_BCAST_ID                    = 0x0101U, /*!< MacTxBcast attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_MAC_RX_UCAST_ID                    = 0x0102U, /*!< MacRxUcast attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_MAC_TX_UCAST_ID                    = 0x0103U, /*!< MacTxUcast attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_MAC_TX_UCAST_RETRY_ID              = 0x0104U, /*!< MacTxUcastRetry attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_MAC_TX_UCAST_FAIL_ID               = 0x0105U, /*!< MacTxUcastFail attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_APS_RX_BCAST_ID                    = 0x0106U, /*!< APSRxBcast attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_APS_TX_BCAST_ID                    = 0x0107U, /*!< APSTxBcast attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_APS_RX_UCAST_ID                    = 0x0108U, /*!< APSRxUcast attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_APS_TX_UCAST_SUCCESS_ID            = 0x0109U, /*!< APSTxUcastSuccess attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_APS_TX_UCAST_RETRY_ID              = 0x010AU, /*!< APSTxUcastRetry attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_APS_TX_UCAST_FAIL_ID               = 0x010BU, /*!< APSTxUcastFail attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_ROUTE_DISC_INITIATED_ID            = 0x010CU, /*!< RouteDiscInitiated attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_NEIGHBOR_ADDED_ID                  = 0x010DU, /*!< NeighborAdded attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_NEIGHBOR_REMOVED_ID                = 0x010EU, /*!< NeighborRemoved attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_NEIGHBOR_STALE_ID                  = 0x010FU, /*!< NeighborStale attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_JOIN_INDICATION_ID                 = 0x0110U, /*!< JoinIndication attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_CHILD_MOVED_ID                     = 0x0111U, /*!< ChildMoved attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_NWK_FC_FAILURE_ID                  = 0x0112U, /*!< NWKFCFailure attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_APS_FC_FAILURE_ID                  = 0x0113U, /*!< APSFCFailure attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_APS_UNAUTHORIZED_KEY_ID            = 0x0114U, /*!< APSUnauthorizedKey attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_NWK_DECRYPT_FAILURES_ID            = 0x0115U, /*!< NWKDecryptFailures attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_APS_DECRYPT_FAILURES_ID            = 0x0116U, /*!< APSDecryptFailures attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_PACKET_BUFFER_ALLOCATE_FAILURES_ID = 0x0117U, /*!< PacketBufferAllocateFailures attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_RELAYED_UCAST_ID                   = 0x0118U, /*!< RelayedUcast attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_PHY_TO_MAC_QUEUE_LIMIT_REACHED_ID  = 0x0119U, /*!< PhytoMACqueuelimitreached attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_PACKET_VALIDATE_DROP_COUNT_ID      = 0x011AU, /*!< PacketValidatedropcount attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_AVERAGE_MAC_RETRY_PER_APS_ID       = 0x011BU, /*!< AverageMACRetryPerAPSMessageSent attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_LAST_LQI_ID                        = 0x011CU, /*!< LastMessageLQI attribute. */
+    EZB_ZCL_ATTR_DIAGNOSTICS_LAST_RSSI_ID                       = 0x011DU, /*!< LastMessageRSSI attribute. */
+} ezb_zcl_diagnostics_server_attr_t;
+
+/**
+ * @brief Copy the MAC, NWK and APS counters of the stack to the Diagnostics server cluster of an endpoint.
+ *
+ * Only the attributes present in the cluster are updated, a counter larger than the attribute saturates at its
+ * maximum value. The counters are collected once enabled with @ref ezb_mac_stats_enable, @ref ezb_nwk_stats_enable
+ * and @ref ezb_aps_stats_enable. Call it periodically, or before the attributes are read, e.g. by a gateway
+ * collecting the health data of the routers.
+ *
+ * @note The stack does not support the Diagnostics cluster yet: it provides no descriptor for it, and custom clusters
+ *       are limited to manufacturer-specific identifiers. Until it does, no endpoint can hold the cluster and the
+ *       function does nothing but return EZB_ERR_NOT_FOUND. The counters remain available through
+ *       @ref ezb_mac_get_stats, @ref ezb_nwk_get_stats and @ref ezb_aps_get_stats.
+ *
+ * @note The APSTxBcast and PacketBufferAllocateFailures attributes are not updated, the matching APS counters only
+ *       see the application-issued requests, not the device-wide traffic the attributes stand for.
+ *
+ * @param[in] ep_id The endpoint of the Diagnostics server cluster.
+ *
+ * @return
+ *      - EZB_ERR_NONE: On success
+ *      - EZB_ERR_NOT_FOUND: The endpoint has no Diagnostics server cluster with any of the counter attributes
+ */
+ezb_err_t ezb_zcl_diagnostics_update_counters(uint8_t ep_id);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
@@ -0,0 +1,318 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/af.h>
+#include <ezbee/platform/alarm.h>
+#include <ezbee/aps/aps_aggregation.h>
+
+#include "aps/aps_hook.h"
+#include "utils/ezb_timer.h"
+
+#define AGGREGATION_VERSION        0U
+#define AGGREGATION_HEADER_SIZE    1U
+#define AGGREGATION_RECORD_SIZE    3U
+#define AGGREGATION_MIN_CLUSTER_ID 0xfc00U
+
+typedef struct aggregation_container_s {
+    ezb_apsde_data_req_t req;   /* The ASDU is the container, dst_address.addr_mode is NONE if the entry is free */
+    uint8_t count;              /* Number of records */
+    uint32_t deadline;
+} aggregation_container_t;
+
+typedef struct aggregation_ctx_s {
+    ezb_aps_aggregation_config_t config;
+    ezb_aps_aggregation_stats_t stats;
+    aggregation_container_t *containers;
+    uint8_t *buffers;           /* config.max_pending buffers of config.max_length bytes */
+    uint16_t *clusters;         /* The enabled clusters */
+    uint8_t cluster_count;
+    ezb_aps_hook_t hook;
+} aggregation_ctx_t;
+
+static aggregation_ctx_t *s_aggregation;
+static ezb_timer_t s_aggregation_timer;
+
+static bool aggregation_is_enabled(uint16_t cluster_id)
+{
+    for (uint8_t i = 0; i < s_aggregation->cluster_count; i++) {
+        if (s_aggregation->clusters[i] == cluster_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool aggregation_is_eligible(const ezb_apsde_data_req_t *req)
+{
+    uint8_t excluded = EZB_APSDE_TX_OPT_FRAG_PERMITTED | EZB_APSDE_TX_OPT_USE_ALIAS;
+
+    return (req->dst_address.addr_mode == EZB_ADDR_MODE_SHORT || req->dst_address.addr_mode == EZB_ADDR_MODE_EXT) &&
+           req->profile_id == s_aggregation->config.profile_id && !(req->tx_options & excluded) &&
+           AGGREGATION_HEADER_SIZE + AGGREGATION_RECORD_SIZE + req->asdu_length <= s_aggregation->config.max_length &&
+           aggregation_is_enabled(req->cluster_id);
+}
+
+static bool aggregation_match(const aggregation_container_t *container, const ezb_apsde_data_req_t *req)
+{
+    return container->req.dst_address.addr_mode != EZB_ADDR_MODE_NONE &&
+           ezb_address_compare(&container->req.dst_address, &req->dst_address) &&
+           container->req.src_endpoint == req->src_endpoint && container->req.dst_endpoint == req->dst_endpoint &&
+           container->req.profile_id == req->profile_id && container->req.tx_options == req->tx_options &&
+           container->req.radius == req->radius;
+}
+
+static void aggregation_flush(aggregation_container_t *container)
+{
+    ezb_apsde_data_req_t req = container->req;
+    const uint8_t *record = req.asdu + AGGREGATION_HEADER_SIZE;
+
+    /* A single ASDU is sent as it is, without the container overhead. */
+    if (container->count == 1) {
+        req.cluster_id = record[0] | (record[1] << 8);
+        req.asdu_length = record[2];
+        req.asdu += AGGREGATION_HEADER_SIZE + AGGREGATION_RECORD_SIZE;
+    }
+    if (ezb_apsde_data_request(&req) != EZB_ERR_NONE) {
+        /* The caller has been told the ASDUs were accepted, they can only be accounted for here. */
+        s_aggregation->stats.tx_failures++;
+        s_aggregation->stats.tx_dropped += container->count;
+    } else if (container->count > 1) {
+        s_aggregation->stats.tx_asdus += container->count;
+        s_aggregation->stats.tx_containers++;
+    }
+    container->req.dst_address.addr_mode = EZB_ADDR_MODE_NONE;
+    container->count = 0;
+}
+
+static void aggregation_timeout(void *ctx)
+{
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+    uint32_t next = UINT32_MAX;
+
+    for (uint8_t i = 0; i < s_aggregation->config.max_pending; i++) {
+        aggregation_container_t *container = &s_aggregation->containers[i];
+        if (container->req.dst_address.addr_mode == EZB_ADDR_MODE_NONE) {
+            continue;
+        }
+        if ((int32_t)(now - container->deadline) >= 0) {
+            aggregation_flush(container);
+        } else if (container->deadline - now < next) {
+            next = container->deadline - now;
+        }
+    }
+    if (next != UINT32_MAX) {
+        ezb_timer_start(&s_aggregation_timer, next);
+    }
+}
+
+static aggregation_container_t *aggregation_open(const ezb_apsde_data_req_t *req)
+{
+    aggregation_container_t *container = NULL;
+    uint8_t *buffer;
+
+    /* Take a free container, or send the one closest to its deadline. */
+    for (uint8_t i = 0; i < s_aggregation->config.max_pending; i++) {
+        aggregation_container_t *iter = &s_aggregation->containers[i];
+        if (iter->req.dst_address.addr_mode == EZB_ADDR_MODE_NONE) {
+            container = iter;
+            break;
+        }
+        if (!container || (int32_t)(iter->deadline - container->deadline) < 0) {
+            container = iter;
+        }
+    }
+    if (container->req.dst_address.addr_mode != EZB_ADDR_MODE_NONE) {
+        aggregation_flush(container);
+    }
+
+    buffer = container->req.asdu;
+    container->req = *req;
+    container->req.cluster_id = s_aggregation->config.cluster_id;
+    container->req.asdu = buffer;
+    container->req.asdu[0] = AGGREGATION_VERSION;
+    container->req.asdu_length = AGGREGATION_HEADER_SIZE;
+    container->deadline = ezb_plat_milli_alarm_get_now() + s_aggregation->config.hold_time;
+    if (!ezb_timer_is_armed(&s_aggregation_timer)) {
+        ezb_timer_start(&s_aggregation_timer, s_aggregation->config.hold_time);
+    }
+    return container;
+}
+
+static bool aggregation_aps_indication(const ezb_apsde_data_ind_t *ind)
+{
+    ezb_apsde_data_ind_t record;
+    uint32_t offset = AGGREGATION_HEADER_SIZE;
+
+    if (ind->cluster_id != s_aggregation->config.cluster_id || ind->profile_id != s_aggregation->config.profile_id) {
+        return false;
+    }
+    s_aggregation->stats.rx_containers++;
+    /* Check the whole container before passing any ASDU on, each record must be of a cluster enabled here. */
+    if (!ind->asdu_length || ind->asdu[0] != AGGREGATION_VERSION) {
+        s_aggregation->stats.rx_malformed++;
+        return true;
+    }
+    while (offset + AGGREGATION_RECORD_SIZE <= ind->asdu_length) {
+        if (!aggregation_is_enabled(ind->asdu[offset] | (ind->asdu[offset + 1] << 8))) {
+            s_aggregation->stats.rx_malformed++;
+            return true;
+        }
+        offset += AGGREGATION_RECORD_SIZE + ind->asdu[offset + 2];
+    }
+    if (offset != ind->asdu_length) {
+        s_aggregation->stats.rx_malformed++;
+        return true;
+    }
+
+    record = *ind;
+    for (offset = AGGREGATION_HEADER_SIZE; offset < ind->asdu_length;
+         offset += AGGREGATION_RECORD_SIZE + record.asdu_length) {
+        record.cluster_id = ind->asdu[offset] | (ind->asdu[offset + 1] << 8);
+        record.asdu_length = ind->asdu[offset + 2];
+        record.asdu = ind->asdu + offset + AGGREGATION_RECORD_SIZE;
+        s_aggregation->stats.rx_asdus++;
+        /* The hooks registered before this one have seen the container only, pass the ASDU to all of them. */
+        ezb_aps_hook_dispatch_indication(&s_aggregation->hook, &record);
+    }
+    return true;
+}
+
+ezb_err_t ezb_aps_aggregation_init(const ezb_aps_aggregation_config_t *config)
+{
+    if (!config || config->cluster_id < AGGREGATION_MIN_CLUSTER_ID || !config->hold_time ||
+        config->max_length <= AGGREGATION_HEADER_SIZE + AGGREGATION_RECORD_SIZE || !config->max_pending ||
+        !config->max_clusters || config->profile_id == EZB_AF_ZDP_PROFILE_ID) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_aggregation) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_aggregation = calloc(1, sizeof(aggregation_ctx_t));
+    if (!s_aggregation) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_aggregation->containers = calloc(config->max_pending, sizeof(aggregation_container_t));
+    s_aggregation->buffers = malloc((size_t)config->max_pending * config->max_length);
+    s_aggregation->clusters = calloc(config->max_clusters, sizeof(uint16_t));
+    if (!s_aggregation->containers || !s_aggregation->buffers || !s_aggregation->clusters ||
+        !ezb_timer_init(&s_aggregation_timer, "zb_aggr", aggregation_timeout, NULL)) {
+        free(s_aggregation->clusters);
+        free(s_aggregation->buffers);
+        free(s_aggregation->containers);
+        free(s_aggregation);
+        s_aggregation = NULL;
+        return EZB_ERR_NO_MEM;
+    }
+    s_aggregation->config = *config;
+    for (uint8_t i = 0; i < config->max_pending; i++) {
+        s_aggregation->containers[i].req.asdu = s_aggregation->buffers + (size_t)i * config->max_length;
+    }
+    s_aggregation->hook.indication = aggregation_aps_indication;
+    ezb_aps_hook_register(&s_aggregation->hook);
+    return EZB_ERR_NONE;
+}
+
+void ezb_aps_aggregation_deinit(void)
+{
+    if (!s_aggregation) {
+        return;
+    }
+    ezb_timer_deinit(&s_aggregation_timer);
+    ezb_aps_hook_unregister(&s_aggregation->hook);
+    for (uint8_t i = 0; i < s_aggregation->config.max_pending; i++) {
+        if (s_aggregation->containers[i].req.dst_address.addr_mode != EZB_ADDR_MODE_NONE) {
+            aggregation_flush(&s_aggregation->containers[i]);
+        }
+    }
+    free(s_aggregation->clusters);
+    free(s_aggregation->buffers);
+    free(s_aggregation->containers);
+    free(s_aggregation);
+    s_aggregation = NULL;
+}
+
+ezb_err_t ezb_aps_aggregation_enable_cluster(uint16_t cluster_id, bool enable)
+{
+    if (!s_aggregation) {
+        return EZB_ERR_INV_STATE;
+    }
+    for (uint8_t i = 0; i < s_aggregation->cluster_count; i++) {
+        if (s_aggregation->clusters[i] == cluster_id) {
+            if (!enable) {
+                s_aggregation->clusters[i] = s_aggregation->clusters[--s_aggregation->cluster_count];
+            }
+            return EZB_ERR_NONE;
+        }
+    }
+    if (enable) {
+        if (cluster_id == s_aggregation->config.cluster_id) {
+            return EZB_ERR_INV_ARG;
+        }
+        if (s_aggregation->cluster_count == s_aggregation->config.max_clusters) {
+            return EZB_ERR_NO_MEM;
+        }
+        s_aggregation->clusters[s_aggregation->cluster_count++] = cluster_id;
+    }
+    return EZB_ERR_NONE;
+}
+
+ezb_err_t ezb_aps_aggregation_data_request(const ezb_apsde_data_req_t *req)
+{
+    aggregation_container_t *container = NULL;
+    uint8_t *record;
+
+    if (!req || (req->asdu_length && !req->asdu)) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_aggregation) {
+        return EZB_ERR_INV_STATE;
+    }
+    if (!aggregation_is_eligible(req)) {
+        return ezb_apsde_data_request(req);
+    }
+
+    for (uint8_t i = 0; i < s_aggregation->config.max_pending; i++) {
+        if (aggregation_match(&s_aggregation->containers[i], req)) {
+            container = &s_aggregation->containers[i];
+            break;
+        }
+    }
+    if (container &&
+        container->req.asdu_length + AGGREGATION_RECORD_SIZE + req->asdu_length > s_aggregation->config.max_length) {
+        aggregation_flush(container);
+        container = NULL;
+    }
+    if (!container) {
+        container = aggregation_open(req);
+    }
+
+    record = container->req.asdu + container->req.asdu_length;
+    record[0] = req->cluster_id & 0xff;
+    record[1] = req->cluster_id >> 8;
+    record[2] = req->asdu_length;
+    if (req->asdu_length) {
+        memcpy(record + AGGREGATION_RECORD_SIZE, req->asdu, req->asdu_length);
+    }
+    container->req.asdu_length += AGGREGATION_RECORD_SIZE + req->asdu_length;
+    container->count++;
+    return EZB_ERR_NONE;
+}
+
+void ezb_aps_aggregation_get_stats(ezb_aps_aggregation_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_aggregation) {
+        memset(stats, 0, sizeof(ezb_aps_aggregation_stats_t));
+        return;
+    }
+    *stats = s_aggregation->stats;
+}
@@ -0,0 +1,573 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/app_signals.h>
+#include <ezbee/bdb.h>
+#include <ezbee/nwk.h>
+#include <ezbee/zdo/zdo_type.h>
+#include <ezbee/zdo/zdo_nwk_mgmt.h>
+#include <ezbee/aps/aps_binding.h>
+
+#include "aps/aps_binding_zdp.h"
+#include "aps/aps_hook.h"
+#include "utils/ezb_timer.h"
+
+#define BINDING_NONE       UINT16_MAX
+#define BINDING_ITER_END   UINT16_MAX
+#define BINDING_KEY(ep, cluster) (((uint32_t)(ep) << 16) | (cluster))
+
+/* Zigbee specification 2.4.3.2.2 Bind_req, the destination address modes */
+#define ZDP_BIND_ADDR_MODE_GROUP 0x01U
+#define ZDP_BIND_ADDR_MODE_EXT   0x03U
+#define ZDP_BIND_REQ_MIN_SIZE    13U    /* Up to the address mode, with the transaction sequence number */
+#define ZDO_PROFILE_ID           0x0000U
+#define ZDO_ENDPOINT             0x00U
+
+/* The broadcast address of the group frames, all the devices with the receiver on when idle */
+#define BINDING_GROUP_BCAST 0xFFFDU
+
+/* The ZDO requests received while the binding table of the stack is checked */
+#define BINDING_MAX_PENDING 4U
+
+typedef struct binding_src_s {
+    uint32_t key;               /* Source endpoint and cluster */
+    uint16_t head;              /* First destination, BINDING_NONE if none */
+} binding_src_t;
+
+typedef struct binding_dst_s {
+    ezb_address_t addr;
+    uint8_t dst_endpoint;
+    uint16_t next;              /* Next destination of the same source, or next free destination */
+} binding_dst_t;
+
+/* A ZDO request waiting to be checked against the binding table of the stack */
+typedef struct binding_pending_s {
+    ezb_aps_binding_t binding;
+    bool bind;                  /* Bind_req, Unbind_req otherwise */
+    bool used;
+    bool queried;               /* Part of the check in progress */
+    bool present;               /* Found in the binding table of the stack */
+} binding_pending_t;
+
+typedef struct binding_ctx_s {
+    ezb_aps_binding_index_config_t config;
+    ezb_aps_binding_index_stats_t stats;
+    binding_src_t *srcs;        /* stats.src_used pairs, sorted by key */
+    binding_dst_t *dsts;
+    uint16_t free_head;
+    binding_pending_t pending[BINDING_MAX_PENDING];
+    bool querying;
+    bool sync;                  /* The whole binding table of the stack is to be mirrored */
+    bool syncing;               /* The query in progress mirrors the whole binding table of the stack */
+    ezb_aps_hook_t hook;
+} binding_ctx_t;
+
+static binding_ctx_t *s_binding;
+static ezb_timer_t s_binding_timer;
+
+static bool binding_is_valid(const ezb_aps_binding_t *binding)
+{
+    return binding->dst_address.addr_mode == EZB_ADDR_MODE_GROUP || binding->dst_address.addr_mode == EZB_ADDR_MODE_EXT;
+}
+
+static bool binding_dst_match(const binding_dst_t *dst, const ezb_aps_binding_t *binding)
+{
+    if (dst->addr.addr_mode != binding->dst_address.addr_mode) {
+        return false;
+    }
+    if (dst->addr.addr_mode == EZB_ADDR_MODE_GROUP) {
+        return dst->addr.u.group_addr.group == binding->dst_address.u.group_addr.group;
+    }
+    return dst->dst_endpoint == binding->dst_endpoint &&
+           ezb_eui64_compare(&dst->addr.u.extended_addr, &binding->dst_address.u.extended_addr);
+}
+
+/* The index of the pair of @p key, or the index where it would be inserted, with @p found set accordingly. */
+static uint16_t binding_src_search(uint32_t key, bool *found)
+{
+    uint16_t low = 0;
+    uint16_t high = s_binding->stats.src_used;
+
+    while (low < high) {
+        uint16_t mid = low + (high - low) / 2;
+        if (s_binding->srcs[mid].key < key) {
+            low = mid + 1;
+        } else {
+            high = mid;
+        }
+    }
+    *found = low < s_binding->stats.src_used && s_binding->srcs[low].key == key;
+    return low;
+}
+
+static ezb_err_t binding_add(const ezb_aps_binding_t *binding)
+{
+    uint32_t key = BINDING_KEY(binding->src_endpoint, binding->cluster_id);
+    bool found;
+    uint16_t index = binding_src_search(key, &found);
+    binding_src_t *src = &s_binding->srcs[index];
+    binding_dst_t *dst;
+    uint16_t dst_index;
+
+    if (found) {
+        for (uint16_t i = src->head; i != BINDING_NONE; i = s_binding->dsts[i].next) {
+            if (binding_dst_match(&s_binding->dsts[i], binding)) {
+                return EZB_ERR_NONE;
+            }
+        }
+    } else if (s_binding->stats.src_used == s_binding->config.src_size) {
+        return EZB_ERR_NO_MEM;
+    }
+    if (s_binding->free_head == BINDING_NONE) {
+        return EZB_ERR_NO_MEM;
+    }
+
+    if (!found) {
+        memmove(src + 1, src, (s_binding->stats.src_used - index) * sizeof(binding_src_t));
+        src->key = key;
+        src->head = BINDING_NONE;
+        s_binding->stats.src_used++;
+    }
+    dst_index = s_binding->free_head;
+    dst = &s_binding->dsts[dst_index];
+    s_binding->free_head = dst->next;
+    dst->addr = binding->dst_address;
+    if (dst->addr.addr_mode == EZB_ADDR_MODE_GROUP && !dst->addr.u.group_addr.bcast) {
+        dst->addr.u.group_addr.bcast = BINDING_GROUP_BCAST;
+    }
+    dst->dst_endpoint = binding->dst_endpoint;
+    dst->next = src->head;
+    src->head = dst_index;
+    s_binding->stats.dst_used++;
+    return EZB_ERR_NONE;
+}
+
+static void binding_remove(const ezb_aps_binding_t *binding)
+{
+    bool found;
+    uint16_t index = binding_src_search(BINDING_KEY(binding->src_endpoint, binding->cluster_id), &found);
+    binding_src_t *src = &s_binding->srcs[index];
+
+    if (!found) {
+        return;
+    }
+    for (uint16_t *link = &src->head; *link != BINDING_NONE; link = &s_binding->dsts[*link].next) {
+        uint16_t dst_index = *link;
+        if (binding_dst_match(&s_binding->dsts[dst_index], binding)) {
+            *link = s_binding->dsts[dst_index].next;
+            s_binding->dsts[dst_index].next = s_binding->free_head;
+            s_binding->free_head = dst_index;
+            s_binding->stats.dst_used--;
+            break;
+        }
+    }
+    if (src->head == BINDING_NONE) {
+        s_binding->stats.src_used--;
+        memmove(src, src + 1, (s_binding->stats.src_used - index) * sizeof(binding_src_t));
+    }
+}
+
+bool ezb_aps_binding_zdp_parse(const ezb_apsde_data_ind_t *ind, ezb_aps_binding_t *binding)
+{
+    const uint8_t *pos = ind->asdu + 1;
+    ezb_extaddr_t src_addr;
+    ezb_extaddr_t local_addr;
+
+    if (ind->status != 0 || ind->profile_id != ZDO_PROFILE_ID || ind->dst_endpoint != ZDO_ENDPOINT ||
+        (ind->cluster_id != EZB_ZDO_CMD_BIND_REQ && ind->cluster_id != EZB_ZDO_CMD_UNBIND_REQ) ||
+        ind->asdu_length < ZDP_BIND_REQ_MIN_SIZE) {
+        return false;
+    }
+    memcpy(src_addr.u8, pos, sizeof(src_addr.u8));
+    ezb_nwk_get_extended_address(&local_addr);
+    if (!ezb_eui64_compare(&src_addr, &local_addr)) {
+        return false;
+    }
+    memset(binding, 0, sizeof(ezb_aps_binding_t));
+    binding->src_endpoint = pos[8];
+    binding->cluster_id = pos[9] | (pos[10] << 8);
+    if (pos[11] == ZDP_BIND_ADDR_MODE_GROUP && ind->asdu_length >= ZDP_BIND_REQ_MIN_SIZE + 2) {
+        binding->dst_address.addr_mode = EZB_ADDR_MODE_GROUP;
+        binding->dst_address.u.group_addr.group = pos[12] | (pos[13] << 8);
+    } else if (pos[11] == ZDP_BIND_ADDR_MODE_EXT && ind->asdu_length >= ZDP_BIND_REQ_MIN_SIZE + 9) {
+        binding->dst_address.addr_mode = EZB_ADDR_MODE_EXT;
+        memcpy(binding->dst_address.u.extended_addr.u8, pos + 12, 8);
+        binding->dst_endpoint = pos[20];
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool binding_stack_entry_match(const ezb_zdp_nwk_mgmt_bind_table_entry_t *entry,
+                                      const ezb_aps_binding_t *binding)
+{
+    if (entry->src_ep != binding->src_endpoint || entry->cluster_id != binding->cluster_id) {
+        return false;
+    }
+    if (entry->dst_addr_mode == ZDP_BIND_ADDR_MODE_GROUP) {
+        return binding->dst_address.addr_mode == EZB_ADDR_MODE_GROUP &&
+               entry->dst_addr.group_addr.group == binding->dst_address.u.group_addr.group;
+    }
+    return entry->dst_addr_mode == ZDP_BIND_ADDR_MODE_EXT && binding->dst_address.addr_mode == EZB_ADDR_MODE_EXT &&
+           entry->dst_ep == binding->dst_endpoint &&
+           ezb_eui64_compare(&entry->dst_addr.extended_addr, &binding->dst_address.u.extended_addr);
+}
+
+/* The binding of an entry of the binding table of the stack, false if its source is another device. */
+static bool binding_from_stack_entry(const ezb_zdp_nwk_mgmt_bind_table_entry_t *entry, const ezb_extaddr_t *local_addr,
+                                     ezb_aps_binding_t *binding)
+{
+    if (!ezb_eui64_compare(&entry->src_addr, local_addr)) {
+        return false;
+    }
+    memset(binding, 0, sizeof(ezb_aps_binding_t));
+    binding->src_endpoint = entry->src_ep;
+    binding->cluster_id = entry->cluster_id;
+    if (entry->dst_addr_mode == ZDP_BIND_ADDR_MODE_GROUP) {
+        binding->dst_address.addr_mode = EZB_ADDR_MODE_GROUP;
+        binding->dst_address.u.group_addr.group = entry->dst_addr.group_addr.group;
+    } else if (entry->dst_addr_mode == ZDP_BIND_ADDR_MODE_EXT) {
+        binding->dst_address.addr_mode = EZB_ADDR_MODE_EXT;
+        binding->dst_address.u.extended_addr = entry->dst_addr.extended_addr;
+        binding->dst_endpoint = entry->dst_ep;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/* Apply the requests the stack has accepted: a Bind_req whose binding is in its table, an Unbind_req whose binding
+ * is not, then check the requests received meanwhile. */
+static void binding_query_finish(bool complete)
+{
+    bool remaining = false;
+
+    if (!complete) {
+        s_binding->stats.query_failures++;
+    }
+    /* A failed mirror of the whole table is retried once the device is on a network again. */
+    if (s_binding->syncing && complete) {
+        s_binding->sync = false;
+        s_binding->stats.syncs++;
+    }
+    s_binding->syncing = false;
+
+    for (uint8_t i = 0; i < BINDING_MAX_PENDING; i++) {
+        binding_pending_t *pending = &s_binding->pending[i];
+        if (!pending->queried) {
+            remaining = remaining || pending->used;
+            continue;
+        }
+        if (!complete) {
+            s_binding->stats.zdo_dropped++;
+        } else if (pending->bind && pending->present) {
+            binding_add(&pending->binding);
+        } else if (!pending->bind && !pending->present) {
+            binding_remove(&pending->binding);
+        }
+        memset(pending, 0, sizeof(binding_pending_t));
+    }
+    s_binding->querying = false;
+    if (remaining) {
+        ezb_timer_start(&s_binding_timer, 0);
+    }
+}
+
+static ezb_err_t binding_query_page(uint8_t start_index);
+
+static void binding_query_cb(const ezb_zdo_nwk_mgmt_bind_req_result_t *result, void *user_ctx)
+{
+    const ezb_zdp_nwk_mgmt_bind_rsp_field_t *rsp = result->rsp;
+    ezb_extaddr_t local_addr;
+    ezb_aps_binding_t binding;
+    uint16_t next;
+
+    if (!s_binding || !s_binding->querying) {
+        return;
+    }
+    if (result->error != EZB_ERR_NONE || !rsp || rsp->status != EZB_ZDP_STATUS_SUCCESS) {
+        binding_query_finish(false);
+        return;
+    }
+    ezb_nwk_get_extended_address(&local_addr);
+    for (uint8_t i = 0; i < rsp->binding_table_list_count; i++) {
+        if (s_binding->syncing && binding_from_stack_entry(&rsp->binding_table_list[i], &local_addr, &binding) &&
+            binding_add(&binding) != EZB_ERR_NONE) {
+            s_binding->stats.sync_dropped++;
+        }
+        for (uint8_t j = 0; j < BINDING_MAX_PENDING; j++) {
+            binding_pending_t *pending = &s_binding->pending[j];
+            if (pending->queried && binding_stack_entry_match(&rsp->binding_table_list[i], &pending->binding)) {
+                pending->present = true;
+            }
+        }
+    }
+    next = rsp->start_index + rsp->binding_table_list_count;
+    if (!rsp->binding_table_list_count || next >= rsp->binding_table_entries) {
+        binding_query_finish(true);
+    } else if (binding_query_page(next) != EZB_ERR_NONE) {
+        binding_query_finish(false);
+    }
+}
+
+static ezb_err_t binding_query_page(uint8_t start_index)
+{
+    ezb_zdo_nwk_mgmt_bind_req_t req = {
+        .dst_nwk_addr = ezb_nwk_get_short_address(),
+        .field.start_index = start_index,
+        .cb = binding_query_cb,
+    };
+
+    return ezb_zdo_nwk_mgmt_bind_req(&req);
+}
+
+/* Read the binding table of the stack with Mgmt_Bind_req sent to this device, once the requests are processed. The
+ * request is answered by the stack of this device without going on air. */
+static void binding_query_start(void *ctx)
+{
+    bool pending = false;
+
+    if (s_binding->querying) {
+        return;
+    }
+    for (uint8_t i = 0; i < BINDING_MAX_PENDING; i++) {
+        s_binding->pending[i].queried = s_binding->pending[i].used;
+        pending = pending || s_binding->pending[i].used;
+    }
+    if (!pending && !s_binding->sync) {
+        return;
+    }
+    s_binding->syncing = s_binding->sync;
+    s_binding->querying = true;
+    if (binding_query_page(0) != EZB_ERR_NONE) {
+        binding_query_finish(false);
+    }
+}
+
+/* Queue the ZDO Bind_req and Unbind_req addressed to this device, the stack processes them first. */
+static bool binding_aps_indication(const ezb_apsde_data_ind_t *ind)
+{
+    ezb_aps_binding_t binding;
+
+    if (!ezb_aps_binding_zdp_parse(ind, &binding)) {
+        return false;
+    }
+    for (uint8_t i = 0; i < BINDING_MAX_PENDING; i++) {
+        binding_pending_t *pending = &s_binding->pending[i];
+        if (!pending->used) {
+            pending->binding = binding;
+            pending->bind = ind->cluster_id == EZB_ZDO_CMD_BIND_REQ;
+            pending->used = true;
+            if (!s_binding->querying && !ezb_timer_is_armed(&s_binding_timer)) {
+                ezb_timer_start(&s_binding_timer, 0);
+            }
+            return false;
+        }
+    }
+    s_binding->stats.zdo_dropped++;
+    return false;
+}
+
+/* Mirror the binding table of the stack, restored from its storage or not, each time the device is on a network. */
+static bool binding_signal_handler(const ezb_app_signal_t *app_signal)
+{
+    ezb_app_signal_type_t type = ezb_app_signal_get_type(app_signal);
+
+    if (!s_binding || (type != EZB_BDB_SIGNAL_DEVICE_FIRST_START && type != EZB_BDB_SIGNAL_DEVICE_REBOOT &&
+                       type != EZB_BDB_SIGNAL_FORMATION && type != EZB_BDB_SIGNAL_STEERING) ||
+        *((ezb_bdb_comm_status_t *)ezb_app_signal_get_params(app_signal)) != EZB_BDB_STATUS_SUCCESS) {
+        return false;
+    }
+    s_binding->sync = true;
+    if (!s_binding->querying && !ezb_timer_is_armed(&s_binding_timer)) {
+        ezb_timer_start(&s_binding_timer, 0);
+    }
+    return false;
+}
+
+ezb_err_t ezb_aps_binding_index_init(const ezb_aps_binding_index_config_t *config)
+{
+    if (!config || !config->src_size || !config->dst_size || config->dst_size == BINDING_NONE) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_binding) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_binding = calloc(1, sizeof(binding_ctx_t));
+    if (!s_binding) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_binding->srcs = calloc(config->src_size, sizeof(binding_src_t));
+    s_binding->dsts = calloc(config->dst_size, sizeof(binding_dst_t));
+    if (!s_binding->srcs || !s_binding->dsts ||
+        (config->mirror_zdo && !ezb_timer_init(&s_binding_timer, "zb_bind", binding_query_start, NULL))) {
+        goto error;
+    }
+    if (config->mirror_zdo && ezb_app_signal_add_handler(binding_signal_handler) != EZB_ERR_NONE) {
+        ezb_timer_deinit(&s_binding_timer);
+        goto error;
+    }
+    s_binding->config = *config;
+    for (uint16_t i = 0; i < config->dst_size; i++) {
+        s_binding->dsts[i].next = i + 1 < config->dst_size ? i + 1 : BINDING_NONE;
+    }
+    s_binding->free_head = 0;
+    if (config->mirror_zdo) {
+        s_binding->hook.indication = binding_aps_indication;
+        ezb_aps_hook_register(&s_binding->hook);
+        /* The bindings restored by the stack are mirrored now if the device is already on a network, once it joins
+         * or rejoins otherwise. */
+        s_binding->sync = true;
+        if (ezb_bdb_dev_joined()) {
+            ezb_timer_start(&s_binding_timer, 0);
+        }
+    }
+    return EZB_ERR_NONE;
+
+error:
+    free(s_binding->dsts);
+    free(s_binding->srcs);
+    free(s_binding);
+    s_binding = NULL;
+    return EZB_ERR_NO_MEM;
+}
+
+void ezb_aps_binding_index_deinit(void)
+{
+    if (!s_binding) {
+        return;
+    }
+    if (s_binding->config.mirror_zdo) {
+        ezb_timer_deinit(&s_binding_timer);
+        ezb_app_signal_remove_handler(binding_signal_handler);
+        ezb_aps_hook_unregister(&s_binding->hook);
+    }
+    free(s_binding->dsts);
+    free(s_binding->srcs);
+    free(s_binding);
+    s_binding = NULL;
+}
+
+ezb_err_t ezb_aps_binding_add_batch(const ezb_aps_binding_t *bindings, uint16_t count, uint16_t *added)
+{
+    ezb_err_t ret = EZB_ERR_NONE;
+    uint16_t i;
+
+    if (!bindings && count) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_binding) {
+        return EZB_ERR_INV_STATE;
+    }
+    for (i = 0; i < count && ret == EZB_ERR_NONE; i++) {
+        ret = binding_is_valid(&bindings[i]) ? binding_add(&bindings[i]) : EZB_ERR_INV_ARG;
+    }
+    if (added) {
+        *added = ret == EZB_ERR_NONE ? i : i - 1;
+    }
+    return ret;
+}
+
+ezb_err_t ezb_aps_binding_remove_batch(const ezb_aps_binding_t *bindings, uint16_t count)
+{
+    if (!bindings && count) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_binding) {
+        return EZB_ERR_INV_STATE;
+    }
+    for (uint16_t i = 0; i < count; i++) {
+        binding_remove(&bindings[i]);
+    }
+    return EZB_ERR_NONE;
+}
+
+ezb_err_t ezb_aps_binding_get_next(uint8_t src_endpoint, uint16_t cluster_id, uint16_t *iter,
+                                   ezb_aps_binding_t *binding)
+{
+    uint16_t index;
+    bool found;
+
+    if (!iter || !binding) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_binding || *iter == BINDING_ITER_END) {
+        return EZB_ERR_NOT_FOUND;
+    }
+    /* The iterator holds the index of the next destination plus one, 0 to start. */
+    if (*iter == 0) {
+        index = binding_src_search(BINDING_KEY(src_endpoint, cluster_id), &found);
+        index = found ? s_binding->srcs[index].head : BINDING_NONE;
+    } else {
+        index = *iter - 1;
+    }
+    if (index == BINDING_NONE) {
+        *iter = BINDING_ITER_END;
+        return EZB_ERR_NOT_FOUND;
+    }
+
+    binding->src_endpoint = src_endpoint;
+    binding->cluster_id = cluster_id;
+    binding->dst_address = s_binding->dsts[index].addr;
+    binding->dst_endpoint = s_binding->dsts[index].dst_endpoint;
+    index = s_binding->dsts[index].next;
+    *iter = index == BINDING_NONE ? BINDING_ITER_END : index + 1;
+    return EZB_ERR_NONE;
+}
+
+ezb_err_t ezb_aps_binding_data_request(const ezb_apsde_data_req_t *req, uint16_t *sent)
+{
+    ezb_err_t ret = EZB_ERR_NONE;
+    ezb_apsde_data_req_t dst_req;
+    uint16_t count = 0;
+    uint16_t index;
+    bool found;
+
+    if (!req || (req->asdu_length && !req->asdu)) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_binding) {
+        return EZB_ERR_INV_STATE;
+    }
+    index = binding_src_search(BINDING_KEY(req->src_endpoint, req->cluster_id), &found);
+    if (!found) {
+        return EZB_ERR_NOT_FOUND;
+    }
+
+    dst_req = *req;
+    for (index = s_binding->srcs[index].head; index != BINDING_NONE; index = s_binding->dsts[index].next) {
+        ezb_err_t err;
+        dst_req.dst_address = s_binding->dsts[index].addr;
+        dst_req.dst_endpoint = s_binding->dsts[index].dst_endpoint;
+        err = ezb_apsde_data_request(&dst_req);
+        if (err == EZB_ERR_NONE) {
+            count++;
+        } else if (ret == EZB_ERR_NONE) {
+            ret = err;
+        }
+    }
+    if (sent) {
+        *sent = count;
+    }
+    return ret;
+}
+
+void ezb_aps_binding_index_get_stats(ezb_aps_binding_index_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_binding) {
+        memset(stats, 0, sizeof(ezb_aps_binding_index_stats_t));
+        return;
+    }
+    *stats = s_binding->stats;
+}
@@ -0,0 +1,23 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+
+#include <ezbee/aps/aps_binding.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Decode a ZDO Bind_req or Unbind_req received for a binding of this device, return false for any other indication
+ * or a malformed request. */
+bool ezb_aps_binding_zdp_parse(const ezb_apsde_data_ind_t *ind, ezb_aps_binding_t *binding);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
@@ -0,0 +1,184 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/aps/aps_buffer.h>
+
+#define BUFFER_INVALID_INDEX UINT16_MAX
+
+typedef struct buffer_pool_s {
+    ezb_aps_buffer_pool_config_t config;
+    ezb_aps_buffer_pool_stats_t stats;
+    uint32_t stride;            /* config.size rounded up to 4 bytes */
+    uint8_t *data;
+    uint8_t *refs;              /* Reference count of each buffer, 0 if the buffer is in the pool */
+    uint16_t *free_list;        /* Stack of the indexes of the free buffers, stats.free entries */
+} buffer_pool_t;
+
+static buffer_pool_t *s_pool;
+
+static uint16_t buffer_index(const uint8_t *buf)
+{
+    size_t offset;
+
+    if (!s_pool || !buf || buf < s_pool->data) {
+        return BUFFER_INVALID_INDEX;
+    }
+    offset = buf - s_pool->data;
+    if (offset % s_pool->stride || offset / s_pool->stride >= s_pool->config.count) {
+        return BUFFER_INVALID_INDEX;
+    }
+    return offset / s_pool->stride;
+}
+
+static void buffer_pool_free(void)
+{
+    free(s_pool->free_list);
+    free(s_pool->refs);
+    free(s_pool->data);
+    free(s_pool);
+    s_pool = NULL;
+}
+
+ezb_err_t ezb_aps_buffer_pool_init(const ezb_aps_buffer_pool_config_t *config)
+{
+    uint32_t stride;
+
+    if (!config || !config->count || config->count == BUFFER_INVALID_INDEX || !config->size ||
+        config->size > EZB_APS_BUFFER_MAX_SIZE) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_pool) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    stride = ((uint32_t)config->size + 3U) & ~3U;
+    s_pool = calloc(1, sizeof(buffer_pool_t));
+    if (!s_pool) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_pool->data = malloc((size_t)config->count * stride);
+    s_pool->refs = calloc(config->count, sizeof(uint8_t));
+    s_pool->free_list = malloc(config->count * sizeof(uint16_t));
+    if (!s_pool->data || !s_pool->refs || !s_pool->free_list) {
+        buffer_pool_free();
+        return EZB_ERR_NO_MEM;
+    }
+    s_pool->config = *config;
+    s_pool->stride = stride;
+    for (uint16_t i = 0; i < config->count; i++) {
+        s_pool->free_list[i] = config->count - 1 - i;
+    }
+    s_pool->stats.count = config->count;
+    s_pool->stats.free = config->count;
+    s_pool->stats.low_water = config->count;
+    return EZB_ERR_NONE;
+}
+
+ezb_err_t ezb_aps_buffer_pool_deinit(void)
+{
+    if (!s_pool) {
+        return EZB_ERR_INV_STATE;
+    }
+    /* A buffer still referenced would be left dangling. */
+    if (s_pool->stats.free != s_pool->stats.count) {
+        return EZB_ERR_BUSY;
+    }
+    buffer_pool_free();
+    return EZB_ERR_NONE;
+}
+
+uint8_t *ezb_aps_buffer_alloc(uint16_t *size)
+{
+    uint16_t index;
+
+    if (!s_pool) {
+        return NULL;
+    }
+    if (!s_pool->stats.free) {
+        s_pool->stats.alloc_failures++;
+        return NULL;
+    }
+    index = s_pool->free_list[--s_pool->stats.free];
+    if (s_pool->stats.free < s_pool->stats.low_water) {
+        s_pool->stats.low_water = s_pool->stats.free;
+    }
+    s_pool->refs[index] = 1;
+    if (size) {
+        *size = s_pool->config.size;
+    }
+    return s_pool->data + (size_t)index * s_pool->stride;
+}
+
+ezb_err_t ezb_aps_buffer_ref(uint8_t *buf)
+{
+    uint16_t index = buffer_index(buf);
+
+    if (index == BUFFER_INVALID_INDEX || !s_pool->refs[index]) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_pool->refs[index] == UINT8_MAX) {
+        return EZB_ERR_NOT_ALLOWED;
+    }
+    s_pool->refs[index]++;
+    return EZB_ERR_NONE;
+}
+
+void ezb_aps_buffer_release(uint8_t *buf)
+{
+    uint16_t index = buffer_index(buf);
+
+    if (index == BUFFER_INVALID_INDEX || !s_pool->refs[index]) {
+        return;
+    }
+    if (--s_pool->refs[index] == 0) {
+        s_pool->free_list[s_pool->stats.free++] = index;
+    }
+}
+
+ezb_err_t ezb_aps_buffer_data_request(const ezb_apsde_data_req_t *req)
+{
+    ezb_err_t ret;
+
+    if (!req || buffer_index(req->asdu) == BUFFER_INVALID_INDEX) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (req->asdu_length > s_pool->config.size) {
+        ret = EZB_ERR_INV_ARG;
+    } else {
+        ret = ezb_apsde_data_request(req);
+    }
+    ezb_aps_buffer_release(req->asdu);
+    return ret;
+}
+
+uint8_t *ezb_aps_buffer_retain_indication(const ezb_apsde_data_ind_t *ind)
+{
+    uint8_t *buf;
+
+    if (!ind || (ind->asdu_length && !ind->asdu) || !s_pool || ind->asdu_length > s_pool->config.size) {
+        return NULL;
+    }
+    buf = ezb_aps_buffer_alloc(NULL);
+    if (buf && ind->asdu_length) {
+        memcpy(buf, ind->asdu, ind->asdu_length);
+    }
+    return buf;
+}
+
+void ezb_aps_buffer_pool_get_stats(ezb_aps_buffer_pool_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_pool) {
+        memset(stats, 0, sizeof(ezb_aps_buffer_pool_stats_t));
+        return;
+    }
+    *stats = s_pool->stats;
+}
@@ -0,0 +1,133 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+
+#include <ezbee/aps/aps_dispatch.h>
+
+#include "aps/aps_hook.h"
+#include "utils/ezb_hash.h"
+
+#define DISPATCH_BUCKET_BITS  5U
+#define DISPATCH_BUCKET_COUNT (1U << DISPATCH_BUCKET_BITS)
+
+/* The filters an indication can match, from the exact one to the one of any profile, cluster and endpoint */
+#define DISPATCH_ANY_ENDPOINT_BIT 0x01U
+#define DISPATCH_ANY_CLUSTER_BIT  0x02U
+#define DISPATCH_ANY_PROFILE_BIT  0x04U
+#define DISPATCH_FILTER_COUNT     8U
+
+static ezb_aps_dispatch_handler_t *s_buckets[DISPATCH_BUCKET_COUNT];
+static uint16_t s_handler_count;
+static ezb_aps_hook_t s_dispatch_hook;
+
+static inline uint64_t dispatch_key(uint16_t profile_id, uint16_t cluster_id, uint8_t endpoint)
+{
+    return ((uint64_t)profile_id << 24) | ((uint64_t)cluster_id << 8) | endpoint;
+}
+
+static inline uint64_t dispatch_handler_key(const ezb_aps_dispatch_handler_t *handler)
+{
+    return dispatch_key(handler->profile_id, handler->cluster_id, handler->endpoint);
+}
+
+static inline ezb_aps_dispatch_handler_t **dispatch_bucket(uint64_t key)
+{
+    return &s_buckets[ezb_hash_mix64(key) >> (32 - DISPATCH_BUCKET_BITS)];
+}
+
+static ezb_aps_dispatch_handler_t *dispatch_find(ezb_aps_dispatch_handler_t *handler, uint64_t key)
+{
+    while (handler && dispatch_handler_key(handler) != key) {
+        handler = handler->next;
+    }
+    return handler;
+}
+
+static bool dispatch_aps_indication(const ezb_apsde_data_ind_t *ind)
+{
+    ezb_aps_dispatch_handler_t *cursors[DISPATCH_FILTER_COUNT] = {0};
+    uint64_t keys[DISPATCH_FILTER_COUNT];
+
+    for (uint8_t filter = 0; filter < DISPATCH_FILTER_COUNT; filter++) {
+        /* A field of the indication equal to its wildcard already selects the handlers of any value. */
+        if (((filter & DISPATCH_ANY_PROFILE_BIT) && ind->profile_id == EZB_APS_DISPATCH_ANY_PROFILE) ||
+            ((filter & DISPATCH_ANY_CLUSTER_BIT) && ind->cluster_id == EZB_APS_DISPATCH_ANY_CLUSTER) ||
+            ((filter & DISPATCH_ANY_ENDPOINT_BIT) && ind->dst_endpoint == EZB_APS_DISPATCH_ANY_ENDPOINT)) {
+            continue;
+        }
+        keys[filter] = dispatch_key(
+            (filter & DISPATCH_ANY_PROFILE_BIT) ? EZB_APS_DISPATCH_ANY_PROFILE : ind->profile_id,
+            (filter & DISPATCH_ANY_CLUSTER_BIT) ? EZB_APS_DISPATCH_ANY_CLUSTER : ind->cluster_id,
+            (filter & DISPATCH_ANY_ENDPOINT_BIT) ? EZB_APS_DISPATCH_ANY_ENDPOINT : ind->dst_endpoint);
+        cursors[filter] = dispatch_find(*dispatch_bucket(keys[filter]), keys[filter]);
+    }
+
+    /* Each bucket is sorted by priority, merge the handlers of the matching filters. */
+    for (;;) {
+        ezb_aps_dispatch_handler_t *handler;
+        int8_t best = -1;
+        for (uint8_t filter = 0; filter < DISPATCH_FILTER_COUNT; filter++) {
+            if (cursors[filter] && (best < 0 || cursors[filter]->priority > cursors[best]->priority)) {
+                best = filter;
+            }
+        }
+        if (best < 0) {
+            return false;
+        }
+        handler = cursors[best];
+        cursors[best] = dispatch_find(handler->next, keys[best]);
+        if (handler->callback(ind)) {
+            return true;
+        }
+    }
+}
+
+ezb_err_t ezb_aps_dispatch_register(ezb_aps_dispatch_handler_t *handler)
+{
+    ezb_aps_dispatch_handler_t **link;
+
+    if (!handler || !handler->callback) {
+        return EZB_ERR_INV_ARG;
+    }
+    link = dispatch_bucket(dispatch_handler_key(handler));
+    for (ezb_aps_dispatch_handler_t *iter = *link; iter; iter = iter->next) {
+        if (iter == handler) {
+            return EZB_ERR_INV_STATE;
+        }
+    }
+
+    /* Insert after the handlers of the same or a higher priority. */
+    while (*link && (*link)->priority >= handler->priority) {
+        link = &(*link)->next;
+    }
+    handler->next = *link;
+    *link = handler;
+    if (!s_handler_count++) {
+        s_dispatch_hook.indication = dispatch_aps_indication;
+        ezb_aps_hook_register(&s_dispatch_hook);
+    }
+    return EZB_ERR_NONE;
+}
+
+ezb_err_t ezb_aps_dispatch_unregister(ezb_aps_dispatch_handler_t *handler)
+{
+    if (!handler) {
+        return EZB_ERR_INV_ARG;
+    }
+    for (ezb_aps_dispatch_handler_t **link = dispatch_bucket(dispatch_handler_key(handler)); *link;
+         link = &(*link)->next) {
+        if (*link == handler) {
+            *link = handler->next;
+            handler->next = NULL;
+            if (!--s_handler_count) {
+                ezb_aps_hook_unregister(&s_dispatch_hook);
+            }
+            return EZB_ERR_NONE;
+        }
+    }
+    return EZB_ERR_NOT_FOUND;
+}
@@ -0,0 +1,289 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/nwk.h>
+#include <ezbee/platform/alarm.h>
+#include <ezbee/aps/aps_dup.h>
+
+#include "aps/aps_hook.h"
+#include "mac/mac_radio_hook.h"
+#include "nwk/nwk_security.h"
+#include "utils/ezb_hash.h"
+
+/* Number of slots probed from the home slot of a key. */
+#define DUP_MAX_PROBE 8U
+
+/* Frames waiting for their indication, forgotten if the stack does not indicate them in time. */
+#define DUP_MAX_PENDING      8U
+#define DUP_PENDING_LIFETIME 250U
+
+/* Zigbee specification 2.2.5.1, APS frame format */
+#define APS_FCF_TYPE_MASK        0x03U
+#define APS_FCF_TYPE_DATA        0x00U
+#define APS_FCF_DELIVERY_SHIFT   2U
+#define APS_FCF_DELIVERY_MASK    0x03U
+#define APS_FCF_DELIVERY_UNICAST 0x00U
+#define APS_FCF_SECURITY         0x20U
+#define APS_FCF_ACK_REQUEST      0x40U
+#define APS_FCF_EXT_HEADER       0x80U
+#define APS_EXT_FRAG_MASK        0x03U
+#define APS_UNICAST_HEADER_SIZE  8U
+
+typedef struct dup_entry_s {
+    uint32_t key;       /* Source address, APS counter and block number */
+    uint32_t time;      /* Reception time, in milliseconds */
+    bool used;
+} dup_entry_t;
+
+/* A frame seen on the radio and waiting for its APSDE-DATA.indication. It is a duplicate by its source and APS
+ * counter, the content only tells apart the frames of the same source waiting at the same time. */
+typedef struct dup_pending_s {
+    ezb_shortaddr_t src;
+    uint8_t counter;
+    bool duplicate;
+    uint16_t cluster_id;
+    uint16_t profile_id;
+    uint8_t src_endpoint;
+    uint8_t dst_endpoint;
+    uint8_t asdu_length;
+    uint32_t asdu_hash;
+    uint32_t seq;       /* Order of reception */
+    uint32_t time;
+    bool used;
+} dup_pending_t;
+
+typedef struct dup_ctx_s {
+    ezb_aps_dup_table_stats_t stats;
+    uint32_t expiry;
+    uint32_t seq;
+    dup_entry_t *entries;
+    dup_pending_t pending[DUP_MAX_PENDING];
+    ezb_mac_radio_hook_t radio_hook;
+    ezb_aps_hook_t aps_hook;
+} dup_ctx_t;
+
+static dup_ctx_t *s_dup;
+
+static inline uint16_t dup_home(uint32_t key)
+{
+    return (uint16_t)(((uint64_t)ezb_hash_mix32(key) * s_dup->stats.size) >> 32);
+}
+
+static inline bool dup_is_expired(const dup_entry_t *entry, uint32_t now)
+{
+    return now - entry->time >= s_dup->expiry;
+}
+
+/* Free and expired entries are replaced first, then the oldest one. */
+static uint32_t dup_age(const dup_entry_t *entry, uint32_t now)
+{
+    return (!entry->used || dup_is_expired(entry, now)) ? UINT32_MAX : now - entry->time;
+}
+
+/* Return true if the key is a duplicate, add it to the table otherwise. */
+static bool dup_check(uint32_t key, uint32_t now)
+{
+    uint16_t slot = dup_home(key);
+    uint8_t probe = s_dup->stats.size < DUP_MAX_PROBE ? s_dup->stats.size : DUP_MAX_PROBE;
+    dup_entry_t *victim = NULL;
+
+    for (uint8_t i = 0; i < probe; i++) {
+        dup_entry_t *entry = &s_dup->entries[slot];
+        if (entry->used && entry->key == key && !dup_is_expired(entry, now)) {
+            s_dup->stats.hits++;
+            return true;
+        }
+        if (!victim || dup_age(entry, now) > dup_age(victim, now)) {
+            victim = entry;
+        }
+        slot = (slot + 1) % s_dup->stats.size;
+    }
+
+    s_dup->stats.misses++;
+    if (!victim->used) {
+        s_dup->stats.used++;
+    } else if (!dup_is_expired(victim, now)) {
+        s_dup->stats.evictions++;
+    }
+    victim->key = key;
+    victim->time = now;
+    victim->used = true;
+    return false;
+}
+
+static void dup_pending_add(ezb_shortaddr_t src, const uint8_t *aps, uint8_t aps_len, bool duplicate, uint32_t now)
+{
+    dup_pending_t *slot = &s_dup->pending[0];
+
+    /* Replace a free or expired slot, or the oldest one. */
+    for (uint8_t i = 0; i < DUP_MAX_PENDING; i++) {
+        dup_pending_t *iter = &s_dup->pending[i];
+        if (!iter->used || now - iter->time >= DUP_PENDING_LIFETIME) {
+            slot = iter;
+            break;
+        }
+        if ((int32_t)(iter->time - slot->time) < 0) {
+            slot = iter;
+        }
+    }
+    slot->src = src;
+    slot->counter = aps[7];
+    slot->duplicate = duplicate;
+    slot->dst_endpoint = aps[1];
+    slot->cluster_id = aps[2] | (aps[3] << 8);
+    slot->profile_id = aps[4] | (aps[5] << 8);
+    slot->src_endpoint = aps[6];
+    slot->asdu_length = aps_len - APS_UNICAST_HEADER_SIZE;
+    slot->asdu_hash = ezb_fnv1a_update(EZB_FNV1A_OFFSET_BASIS, aps + APS_UNICAST_HEADER_SIZE, slot->asdu_length);
+    slot->seq = s_dup->seq++;
+    slot->time = now;
+    slot->used = true;
+}
+
+static void dup_radio_rx(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr)
+{
+    uint8_t plain[EZB_NWK_SECURITY_MAX_PAYLOAD];
+    uint8_t plain_len;
+    uint8_t pos = 1;
+    uint8_t fcf;
+    uint8_t block = 0;
+    uint32_t key;
+    uint32_t now;
+    bool duplicate;
+    ezb_shortaddr_t short_addr = ezb_nwk_get_short_address();
+    ezb_nwk_security_t sec;
+    ezb_nwk_frame_t nwk;
+
+    /* Only the unicast data frames to this device, the broadcast and group frames are left to the stack. */
+    if (mhr->dst.addr_mode != EZB_ADDR_MODE_SHORT || mhr->dst.u.short_addr != short_addr ||
+        !ezb_nwk_frame_parse(mhr, &nwk) || nwk.type != EZB_NWK_FRAME_TYPE_DATA || nwk.dst != short_addr ||
+        !ezb_nwk_security_parse(mhr, &sec) || ezb_nwk_security_decrypt(&sec, plain, &plain_len) != EZB_ERR_NONE ||
+        !plain_len) {
+        return;
+    }
+
+    fcf = plain[0];
+    if ((fcf & APS_FCF_TYPE_MASK) != APS_FCF_TYPE_DATA ||
+        ((fcf >> APS_FCF_DELIVERY_SHIFT) & APS_FCF_DELIVERY_MASK) != APS_FCF_DELIVERY_UNICAST) {
+        return;
+    }
+    /* Destination endpoint, cluster, profile and source endpoint before the APS counter */
+    pos += 6;
+    if (pos >= plain_len) {
+        return;
+    }
+    if ((fcf & APS_FCF_EXT_HEADER) && pos + 1 < plain_len && (plain[pos + 1] & APS_EXT_FRAG_MASK)) {
+        if (pos + 2 >= plain_len) {
+            return;
+        }
+        block = plain[pos + 2];
+    }
+
+    key = ((uint32_t)nwk.src << 16) | ((uint32_t)plain[pos] << 8) | block;
+    now = ezb_plat_milli_alarm_get_now();
+    duplicate = dup_check(key, now);
+    /* The acknowledgement of the first copy may have been lost, the stack acknowledges it again. The fragments, and
+     * the ASDUs secured at the APS layer, cannot be matched to their indication. */
+    if (!(fcf & (APS_FCF_ACK_REQUEST | APS_FCF_EXT_HEADER | APS_FCF_SECURITY))) {
+        dup_pending_add(nwk.src, plain, plain_len, duplicate, now);
+    }
+}
+
+/* The duplicate is dropped at the APS layer, once the stack has processed the frame as any other. The stack indicates
+ * the frames of a source in their order of reception, the indication is the one of the oldest frame of its source
+ * with the same content. The older frames of the source were not indicated by the stack, they are forgotten. */
+static bool dup_aps_indication(const ezb_apsde_data_ind_t *ind)
+{
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+    dup_pending_t *match = NULL;
+    uint32_t asdu_hash;
+    bool duplicate;
+
+    if (ind->src_address.addr_mode != EZB_ADDR_MODE_SHORT || ind->asdu_length > UINT8_MAX) {
+        return false;
+    }
+    asdu_hash = ezb_fnv1a_update(EZB_FNV1A_OFFSET_BASIS, ind->asdu, ind->asdu_length);
+    for (uint8_t i = 0; i < DUP_MAX_PENDING; i++) {
+        dup_pending_t *pending = &s_dup->pending[i];
+        if (pending->used && now - pending->time < DUP_PENDING_LIFETIME &&
+            pending->src == ind->src_address.u.short_addr && pending->cluster_id == ind->cluster_id &&
+            pending->profile_id == ind->profile_id && pending->src_endpoint == ind->src_endpoint &&
+            pending->dst_endpoint == ind->dst_endpoint && pending->asdu_length == ind->asdu_length &&
+            pending->asdu_hash == asdu_hash && (!match || (int32_t)(pending->seq - match->seq) < 0)) {
+            match = pending;
+        }
+    }
+    if (!match) {
+        return false;
+    }
+    for (uint8_t i = 0; i < DUP_MAX_PENDING; i++) {
+        dup_pending_t *pending = &s_dup->pending[i];
+        if (pending->used && pending->src == match->src && (int32_t)(pending->seq - match->seq) < 0) {
+            pending->used = false;
+        }
+    }
+    duplicate = match->duplicate;
+    match->used = false;
+    if (duplicate) {
+        s_dup->stats.dropped++;
+    }
+    return duplicate;
+}
+
+ezb_err_t ezb_aps_dup_table_init(const ezb_aps_dup_table_config_t *config)
+{
+    if (!config || !config->size) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_dup) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_dup = calloc(1, sizeof(dup_ctx_t));
+    if (!s_dup) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_dup->entries = calloc(config->size, sizeof(dup_entry_t));
+    if (!s_dup->entries) {
+        free(s_dup);
+        s_dup = NULL;
+        return EZB_ERR_NO_MEM;
+    }
+    s_dup->stats.size = config->size;
+    s_dup->expiry = config->expiry ? config->expiry : EZB_APS_DUP_TABLE_DEFAULT_EXPIRY;
+    s_dup->radio_hook.rx = dup_radio_rx;
+    ezb_mac_radio_hook_register(&s_dup->radio_hook);
+    s_dup->aps_hook.indication = dup_aps_indication;
+    ezb_aps_hook_register(&s_dup->aps_hook);
+    return EZB_ERR_NONE;
+}
+
+void ezb_aps_dup_table_deinit(void)
+{
+    if (!s_dup) {
+        return;
+    }
+    ezb_aps_hook_unregister(&s_dup->aps_hook);
+    ezb_mac_radio_hook_unregister(&s_dup->radio_hook);
+    free(s_dup->entries);
+    free(s_dup);
+    s_dup = NULL;
+}
+
+void ezb_aps_dup_table_get_stats(ezb_aps_dup_table_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_dup) {
+        memset(stats, 0, sizeof(ezb_aps_dup_table_stats_t));
+        return;
+    }
+    *stats = s_dup->stats;
+}
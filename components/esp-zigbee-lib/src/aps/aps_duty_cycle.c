@@ -0,0 +1,173 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/mac.h>
+#include <ezbee/platform/alarm.h>
+#include <ezbee/aps/aps_duty_cycle.h>
+
+#include "utils/ezb_timer.h"
+
+#define DUTY_CYCLE_RELEASE_INTERVAL_MS 100U
+#define DUTY_CYCLE_WINDOW_US           60000000U
+
+typedef struct duty_cycle_entry_s {
+    ezb_apsde_data_req_t req;   /* The ASDU points to the owned copy */
+    uint32_t expiry;
+} duty_cycle_entry_t;
+
+typedef struct duty_cycle_ctx_s {
+    ezb_aps_duty_cycle_config_t config;
+    ezb_aps_duty_cycle_stats_t stats;
+    duty_cycle_entry_t *entries;    /* FIFO of config.depth entries */
+    uint8_t head;
+} duty_cycle_ctx_t;
+
+static duty_cycle_ctx_t *s_duty;
+static ezb_timer_t s_duty_timer;
+
+static bool duty_cycle_exceeded(void)
+{
+    ezb_mac_airtime_t airtime;
+
+    if (ezb_mac_airtime_get_local(&airtime) != EZB_ERR_NONE) {
+        return false;
+    }
+    s_duty->stats.tx_airtime = airtime.tx_minute;
+    s_duty->stats.exceeded = (uint64_t)airtime.tx_minute * 1000U >=
+                             (uint64_t)s_duty->config.budget * DUTY_CYCLE_WINDOW_US;
+    return s_duty->stats.exceeded;
+}
+
+static duty_cycle_entry_t *duty_cycle_head(void)
+{
+    return s_duty->stats.queued ? &s_duty->entries[s_duty->head] : NULL;
+}
+
+static void duty_cycle_pop(void)
+{
+    free(s_duty->entries[s_duty->head].req.asdu);
+    memset(&s_duty->entries[s_duty->head], 0, sizeof(duty_cycle_entry_t));
+    s_duty->head = (s_duty->head + 1) % s_duty->config.depth;
+    s_duty->stats.queued--;
+}
+
+static void duty_cycle_release(void *ctx)
+{
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+    duty_cycle_entry_t *entry;
+
+    while ((entry = duty_cycle_head()) && (int32_t)(now - entry->expiry) >= 0) {
+        s_duty->stats.discarded++;
+        duty_cycle_pop();
+    }
+    entry = duty_cycle_head();
+    if (entry && !duty_cycle_exceeded()) {
+        if (ezb_apsde_data_request(&entry->req) == EZB_ERR_NONE) {
+            s_duty->stats.released++;
+        } else {
+            s_duty->stats.discarded++;
+        }
+        duty_cycle_pop();
+    }
+    if (s_duty->stats.queued) {
+        ezb_timer_start(&s_duty_timer, DUTY_CYCLE_RELEASE_INTERVAL_MS);
+    }
+}
+
+ezb_err_t ezb_aps_duty_cycle_init(const ezb_aps_duty_cycle_config_t *config)
+{
+    ezb_mac_airtime_t airtime;
+
+    if (!config || !config->budget || config->budget > 1000 || !config->depth || !config->max_delay) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_duty || ezb_mac_airtime_get_local(&airtime) != EZB_ERR_NONE) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_duty = calloc(1, sizeof(duty_cycle_ctx_t));
+    if (!s_duty) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_duty->entries = calloc(config->depth, sizeof(duty_cycle_entry_t));
+    if (!s_duty->entries || !ezb_timer_init(&s_duty_timer, "zb_duty", duty_cycle_release, NULL)) {
+        free(s_duty->entries);
+        free(s_duty);
+        s_duty = NULL;
+        return EZB_ERR_NO_MEM;
+    }
+    s_duty->config = *config;
+    return EZB_ERR_NONE;
+}
+
+void ezb_aps_duty_cycle_deinit(void)
+{
+    if (!s_duty) {
+        return;
+    }
+    ezb_timer_deinit(&s_duty_timer);
+    while (s_duty->stats.queued) {
+        duty_cycle_pop();
+    }
+    free(s_duty->entries);
+    free(s_duty);
+    s_duty = NULL;
+}
+
+ezb_err_t ezb_aps_duty_cycle_data_request(const ezb_apsde_data_req_t *req, uint8_t priority)
+{
+    duty_cycle_entry_t *entry;
+    uint8_t *asdu = NULL;
+
+    if (!req || (req->asdu_length && !req->asdu)) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_duty) {
+        return EZB_ERR_INV_STATE;
+    }
+    /* Keep the order of the delayed requests, a new one is queued behind them. */
+    if (priority >= s_duty->config.exempt_priority || (!s_duty->stats.queued && !duty_cycle_exceeded())) {
+        return ezb_apsde_data_request(req);
+    }
+    if (s_duty->stats.queued == s_duty->config.depth) {
+        s_duty->stats.rejected++;
+        return EZB_ERR_BUSY;
+    }
+    if (req->asdu_length) {
+        asdu = malloc(req->asdu_length);
+        if (!asdu) {
+            return EZB_ERR_NO_MEM;
+        }
+        memcpy(asdu, req->asdu, req->asdu_length);
+    }
+
+    entry = &s_duty->entries[(s_duty->head + s_duty->stats.queued) % s_duty->config.depth];
+    entry->req = *req;
+    entry->req.asdu = asdu;
+    entry->expiry = ezb_plat_milli_alarm_get_now() + s_duty->config.max_delay;
+    s_duty->stats.queued++;
+    s_duty->stats.delayed++;
+    if (!ezb_timer_is_armed(&s_duty_timer)) {
+        ezb_timer_start(&s_duty_timer, DUTY_CYCLE_RELEASE_INTERVAL_MS);
+    }
+    return EZB_ERR_NONE;
+}
+
+void ezb_aps_duty_cycle_get_stats(ezb_aps_duty_cycle_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_duty) {
+        memset(stats, 0, sizeof(ezb_aps_duty_cycle_stats_t));
+        return;
+    }
+    duty_cycle_exceeded();
+    *stats = s_duty->stats;
+}
@@ -0,0 +1,273 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/platform/alarm.h>
+#include <ezbee/aps/aps_fragment.h>
+
+#include "aps/aps_hook.h"
+#include "utils/ezb_lru.h"
+
+/* Shorter ASDUs are sent in a single frame, their timing tells nothing about the window. */
+#define FRAGMENT_MIN_LENGTH 64U
+#define FRAGMENT_MAX_WINDOW 8U
+/* A transfer without a confirm for this long is taken as lost, so that another one can be adapted. */
+#define FRAGMENT_TRANSFER_TIMEOUT_MS 30000U
+
+typedef struct fragment_dest_s {
+    ezb_address_t addr;         /* EZB_ADDR_MODE_NONE if the entry is free */
+    uint32_t last_used;
+    uint32_t us_per_byte;       /* Smoothed time per byte of the successful transfers, 0 before the first one */
+    ezb_aps_fragment_stats_t stats;
+    /* The transfer in progress */
+    bool pending;
+    uint8_t src_endpoint;
+    uint8_t dst_endpoint;
+    uint16_t cluster_id;
+    uint32_t start;
+} fragment_dest_t;
+
+typedef struct fragment_ctx_s {
+    ezb_aps_fragment_adaptive_config_t config;
+    uint8_t saved_window_size;
+    uint8_t saved_delay;
+    fragment_dest_t *dests;
+    fragment_dest_t *active;    /* The destination of the transfer in progress, the settings are global */
+    fragment_dest_t *prepared;  /* The destination whose settings were applied to the request being submitted */
+    ezb_aps_hook_t hook;
+} fragment_ctx_t;
+
+static fragment_ctx_t *s_fragment;
+
+static bool fragment_is_tracked(const ezb_apsde_data_req_t *req)
+{
+    uint8_t options = EZB_APSDE_TX_OPT_FRAG_PERMITTED | EZB_APSDE_TX_OPT_ACK_TX;
+
+    return (req->tx_options & options) == options && req->asdu_length >= FRAGMENT_MIN_LENGTH &&
+           (req->dst_address.addr_mode == EZB_ADDR_MODE_SHORT || req->dst_address.addr_mode == EZB_ADDR_MODE_EXT);
+}
+
+static bool fragment_dest_is_free(const void *entry)
+{
+    return ((const fragment_dest_t *)entry)->addr.addr_mode == EZB_ADDR_MODE_NONE;
+}
+
+static fragment_dest_t *fragment_find(const ezb_address_t *addr)
+{
+    for (uint8_t i = 0; i < s_fragment->config.max_destinations; i++) {
+        if (s_fragment->dests[i].addr.addr_mode != EZB_ADDR_MODE_NONE &&
+            ezb_address_compare(&s_fragment->dests[i].addr, addr)) {
+            return &s_fragment->dests[i];
+        }
+    }
+    return NULL;
+}
+
+static fragment_dest_t *fragment_find_or_alloc(const ezb_address_t *addr, uint32_t now)
+{
+    fragment_dest_t *dest = fragment_find(addr);
+
+    if (!dest) {
+        dest = ezb_lru_select(s_fragment->dests, s_fragment->config.max_destinations, sizeof(fragment_dest_t),
+                              offsetof(fragment_dest_t, last_used), fragment_dest_is_free);
+        memset(dest, 0, sizeof(fragment_dest_t));
+        dest->addr = *addr;
+        dest->stats.window_size =
+            s_fragment->config.adapt_window ? s_fragment->config.max_window_size : s_fragment->saved_window_size;
+        dest->stats.interframe_delay = s_fragment->config.min_delay;
+    }
+    dest->last_used = now;
+    return dest;
+}
+
+static void fragment_decrease(fragment_dest_t *dest, bool loss)
+{
+    const ezb_aps_fragment_adaptive_config_t *config = &s_fragment->config;
+    uint16_t delay = dest->stats.interframe_delay;
+    uint8_t window = dest->stats.window_size;
+
+    if (loss) {
+        window /= 2;
+        delay = delay ? delay * 2 : config->delay_step;
+    } else {
+        window -= 1;
+        delay += config->delay_step;
+    }
+    if (config->adapt_window) {
+        dest->stats.window_size = window < config->min_window_size ? config->min_window_size : window;
+    }
+    dest->stats.interframe_delay = delay > config->max_delay ? config->max_delay : delay;
+}
+
+static void fragment_increase(fragment_dest_t *dest)
+{
+    const ezb_aps_fragment_adaptive_config_t *config = &s_fragment->config;
+
+    if (config->adapt_window && dest->stats.window_size < config->max_window_size) {
+        dest->stats.window_size++;
+    }
+    if (dest->stats.interframe_delay >= config->min_delay + config->delay_step) {
+        dest->stats.interframe_delay -= config->delay_step;
+    } else {
+        dest->stats.interframe_delay = config->min_delay;
+    }
+}
+
+static void fragment_aps_prepare(const ezb_apsde_data_req_t *req)
+{
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+    fragment_dest_t *dest;
+
+    s_fragment->prepared = NULL;
+    if (!fragment_is_tracked(req)) {
+        return;
+    }
+    if (s_fragment->active && now - s_fragment->active->start >= FRAGMENT_TRANSFER_TIMEOUT_MS) {
+        s_fragment->active->pending = false;
+        s_fragment->active = NULL;
+    }
+    /* The settings apply to every transfer in progress, a transfer started during another one keeps them. */
+    if (s_fragment->active) {
+        return;
+    }
+    dest = fragment_find_or_alloc(&req->dst_address, now);
+    if (s_fragment->config.adapt_window) {
+        ezb_aps_set_fragment_max_window_size(dest->stats.window_size);
+    }
+    ezb_aps_set_fragment_interframe_delay(dest->stats.interframe_delay);
+    s_fragment->prepared = dest;
+}
+
+static void fragment_aps_request(const ezb_apsde_data_req_t *req, ezb_err_t ret)
+{
+    fragment_dest_t *dest = s_fragment->prepared;
+
+    s_fragment->prepared = NULL;
+    if (ret != EZB_ERR_NONE || !dest) {
+        return;
+    }
+    /* A single transfer is adapted and timed at a time. */
+    dest->pending = true;
+    dest->src_endpoint = req->src_endpoint;
+    dest->dst_endpoint = req->dst_endpoint;
+    dest->cluster_id = req->cluster_id;
+    dest->start = ezb_plat_milli_alarm_get_now();
+    s_fragment->active = dest;
+}
+
+static void fragment_aps_confirm(const ezb_apsde_data_confirm_t *confirm)
+{
+    fragment_dest_t *dest = fragment_find(&confirm->dst_address);
+    ezb_aps_fragment_transfer_t transfer = {0};
+
+    if (!dest || !dest->pending || dest->src_endpoint != confirm->src_endpoint ||
+        dest->dst_endpoint != confirm->dst_endpoint || dest->cluster_id != confirm->cluster_id ||
+        confirm->asdu_length < FRAGMENT_MIN_LENGTH) {
+        return;
+    }
+    dest->pending = false;
+    s_fragment->active = NULL;
+
+    transfer.dst_address = confirm->dst_address;
+    transfer.cluster_id = confirm->cluster_id;
+    transfer.length = confirm->asdu_length;
+    transfer.status = confirm->status;
+    transfer.window_size = dest->stats.window_size;
+    transfer.interframe_delay = dest->stats.interframe_delay;
+    transfer.duration = ezb_plat_milli_alarm_get_now() - dest->start;
+
+    dest->stats.transfers++;
+    if (confirm->status != 0) {
+        dest->stats.failures++;
+        fragment_decrease(dest, true);
+    } else {
+        uint32_t duration = transfer.duration ? transfer.duration : 1;
+        uint32_t us_per_byte = duration * 1000U / transfer.length;
+
+        transfer.throughput = (uint32_t)transfer.length * 1000U / duration;
+        dest->stats.bytes += transfer.length;
+        dest->stats.last_throughput = transfer.throughput;
+        if (!dest->us_per_byte) {
+            dest->us_per_byte = us_per_byte;
+            dest->stats.avg_throughput = transfer.throughput;
+            fragment_increase(dest);
+        } else {
+            /* A transfer far slower than usual means the path is congested, back off without halving. */
+            if (us_per_byte > dest->us_per_byte * 2U) {
+                fragment_decrease(dest, false);
+            } else {
+                fragment_increase(dest);
+            }
+            dest->us_per_byte += ((int32_t)us_per_byte - (int32_t)dest->us_per_byte) / 8;
+            dest->stats.avg_throughput +=
+                ((int32_t)transfer.throughput - (int32_t)dest->stats.avg_throughput) / 8;
+        }
+    }
+    if (s_fragment->config.transfer_cb) {
+        s_fragment->config.transfer_cb(&transfer);
+    }
+}
+
+ezb_err_t ezb_aps_fragment_adaptive_init(const ezb_aps_fragment_adaptive_config_t *config)
+{
+    if (!config || config->min_delay > config->max_delay || !config->max_destinations ||
+        (config->adapt_window && (!config->min_window_size || config->min_window_size > config->max_window_size ||
+                                  config->max_window_size > FRAGMENT_MAX_WINDOW))) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_fragment) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_fragment = calloc(1, sizeof(fragment_ctx_t));
+    if (!s_fragment) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_fragment->dests = calloc(config->max_destinations, sizeof(fragment_dest_t));
+    if (!s_fragment->dests) {
+        free(s_fragment);
+        s_fragment = NULL;
+        return EZB_ERR_NO_MEM;
+    }
+    s_fragment->config = *config;
+    s_fragment->saved_window_size = ezb_aps_get_fragment_max_window_size();
+    s_fragment->saved_delay = ezb_aps_get_fragment_interframe_delay();
+    s_fragment->hook.prepare = fragment_aps_prepare;
+    s_fragment->hook.request = fragment_aps_request;
+    s_fragment->hook.confirm = fragment_aps_confirm;
+    ezb_aps_hook_register(&s_fragment->hook);
+    return EZB_ERR_NONE;
+}
+
+void ezb_aps_fragment_adaptive_deinit(void)
+{
+    if (!s_fragment) {
+        return;
+    }
+    ezb_aps_hook_unregister(&s_fragment->hook);
+    ezb_aps_set_fragment_max_window_size(s_fragment->saved_window_size);
+    ezb_aps_set_fragment_interframe_delay(s_fragment->saved_delay);
+    free(s_fragment->dests);
+    free(s_fragment);
+    s_fragment = NULL;
+}
+
+ezb_err_t ezb_aps_fragment_get_stats(const ezb_address_t *dst_address, ezb_aps_fragment_stats_t *stats)
+{
+    fragment_dest_t *dest;
+
+    if (!dst_address || !stats) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_fragment || !(dest = fragment_find(dst_address))) {
+        return EZB_ERR_NOT_FOUND;
+    }
+    *stats = dest->stats;
+    return EZB_ERR_NONE;
+}
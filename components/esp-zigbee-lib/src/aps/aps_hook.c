@@ -0,0 +1,105 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+
+#include "aps/aps_hook.h"
+
+/* The APSDE functions below are wrapped with the linker option "--wrap", see CMakeLists.txt. */
+extern ezb_err_t __real_ezb_apsde_data_request(const ezb_apsde_data_req_t *req);
+extern void __real_ezb_apsde_data_indication_handler_register(ezb_apsde_data_indication_callback_t cb);
+extern void __real_ezb_apsde_data_confirm_handler_register(ezb_apsde_data_confirm_callback_t cb);
+
+static ezb_aps_hook_t *s_hooks;
+static ezb_apsde_data_indication_callback_t s_app_indication_cb;
+static ezb_apsde_data_confirm_callback_t s_app_confirm_cb;
+
+static bool aps_hook_indication(const ezb_apsde_data_ind_t *ind)
+{
+    return ezb_aps_hook_dispatch_indication(NULL, ind);
+}
+
+static void aps_hook_confirm(const ezb_apsde_data_confirm_t *confirm)
+{
+    for (ezb_aps_hook_t *hook = s_hooks; hook; hook = hook->next) {
+        if (hook->confirm) {
+            hook->confirm(confirm);
+        }
+    }
+    if (s_app_confirm_cb) {
+        s_app_confirm_cb(confirm);
+    }
+}
+
+/* Install the indication handler while it is needed, the stack processes the indications otherwise. */
+static void aps_hook_update_indication(void)
+{
+    __real_ezb_apsde_data_indication_handler_register((s_hooks || s_app_indication_cb) ? aps_hook_indication : NULL);
+}
+
+void ezb_aps_hook_register(ezb_aps_hook_t *hook)
+{
+    for (ezb_aps_hook_t *iter = s_hooks; iter; iter = iter->next) {
+        if (iter == hook) {
+            return;
+        }
+    }
+    hook->next = s_hooks;
+    s_hooks = hook;
+    aps_hook_update_indication();
+}
+
+void ezb_aps_hook_unregister(ezb_aps_hook_t *hook)
+{
+    for (ezb_aps_hook_t **link = &s_hooks; *link; link = &(*link)->next) {
+        if (*link == hook) {
+            *link = hook->next;
+            hook->next = NULL;
+            aps_hook_update_indication();
+            return;
+        }
+    }
+}
+
+bool ezb_aps_hook_dispatch_indication(const ezb_aps_hook_t *skip, const ezb_apsde_data_ind_t *ind)
+{
+    for (ezb_aps_hook_t *hook = s_hooks; hook; hook = hook->next) {
+        if (hook != skip && hook->indication && hook->indication(ind)) {
+            return true;
+        }
+    }
+    return s_app_indication_cb ? s_app_indication_cb(ind) : false;
+}
+
+ezb_err_t __wrap_ezb_apsde_data_request(const ezb_apsde_data_req_t *req)
+{
+    ezb_err_t ret;
+
+    for (ezb_aps_hook_t *hook = s_hooks; hook; hook = hook->next) {
+        if (hook->prepare) {
+            hook->prepare(req);
+        }
+    }
+    ret = __real_ezb_apsde_data_request(req);
+    for (ezb_aps_hook_t *hook = s_hooks; hook; hook = hook->next) {
+        if (hook->request) {
+            hook->request(req, ret);
+        }
+    }
+    return ret;
+}
+
+void __wrap_ezb_apsde_data_indication_handler_register(ezb_apsde_data_indication_callback_t cb)
+{
+    s_app_indication_cb = cb;
+    aps_hook_update_indication();
+}
+
+void __wrap_ezb_apsde_data_confirm_handler_register(ezb_apsde_data_confirm_callback_t cb)
+{
+    s_app_confirm_cb = cb;
+    __real_ezb_apsde_data_confirm_handler_register(cb ? aps_hook_confirm : NULL);
+}
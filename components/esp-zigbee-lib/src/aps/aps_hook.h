@@ -0,0 +1,48 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Observer of the APSDE-DATA primitives exchanged between the application and the stack.
+ *
+ * The APSDE functions are wrapped at link time. The requests are seen when they are issued from outside of the stack
+ * library, i.e. by the application and the modules of this component. The indications are seen once a hook is
+ * registered, the confirms only while the application has registered its confirm handler, so that the stack keeps
+ * handling the confirms by itself otherwise. Any callback can be NULL.
+ */
+typedef struct ezb_aps_hook_s {
+    /* An APSDE-DATA.request is about to be issued, the stack parameters that apply to it can be adjusted here. */
+    void (*prepare)(const ezb_apsde_data_req_t *req);
+    /* An APSDE-DATA.request has been issued, @p ret is the result returned to the caller. */
+    void (*request)(const ezb_apsde_data_req_t *req, ezb_err_t ret);
+    /* An APSDE-DATA.indication is received, return true to consume it before the application and the stack. */
+    bool (*indication)(const ezb_apsde_data_ind_t *ind);
+    /* An APSDE-DATA.confirm is received, before it is passed to the application. */
+    void (*confirm)(const ezb_apsde_data_confirm_t *confirm);
+    struct ezb_aps_hook_s *next;
+} ezb_aps_hook_t;
+
+/* Register a hook, the hook object must stay valid until it is unregistered. */
+void ezb_aps_hook_register(ezb_aps_hook_t *hook);
+
+void ezb_aps_hook_unregister(ezb_aps_hook_t *hook);
+
+/* Pass an indication to the hooks other than @p skip, all of them if NULL, then to the application. Return true if it
+ * has been consumed. */
+bool ezb_aps_hook_dispatch_indication(const ezb_aps_hook_t *skip, const ezb_apsde_data_ind_t *ind);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
@@ -0,0 +1,450 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/mac.h>
+#include <ezbee/nwk.h>
+#include <ezbee/platform/alarm.h>
+#include <ezbee/aps/aps_indirect_queue.h>
+
+#include "mac/mac_frame.h"
+#include "mac/mac_radio_hook.h"
+#include "utils/ezb_timer.h"
+
+#define INDIRECT_PURGE_INTERVAL_MS 1000U
+
+/* ZCL frame control: frame type, manufacturer specific (the manufacturer code precedes the sequence number) and
+ * direction. */
+#define ZCL_FRAME_CONTROL_FRAME_TYPE      0x03U
+#define ZCL_FRAME_CONTROL_MANUF_SPECIFIC  0x04U
+#define ZCL_FRAME_CONTROL_DIRECTION       0x08U
+
+typedef struct indirect_entry_s {
+    ezb_apsde_data_req_t req;   /* The ASDU points to the owned copy */
+    uint64_t kind;
+    uint32_t order;
+    uint32_t expiry;
+    uint8_t priority;
+    bool used;
+} indirect_entry_t;
+
+typedef struct indirect_child_s {
+    ezb_shortaddr_t addr;
+    uint8_t in_stack;           /* Requests handed over to the stack and not yet seen transmitted */
+    uint32_t last_activity;     /* Time of the last hand-over or transmission to the child */
+    bool release_pending;
+    ezb_aps_indirect_queue_stats_t stats;
+    indirect_entry_t *entries;  /* config.depth entries */
+} indirect_child_t;
+
+typedef struct indirect_ctx_s {
+    ezb_aps_indirect_queue_config_t config;
+    indirect_child_t *children;
+    ezb_mac_radio_hook_t hook;
+    uint32_t order;
+} indirect_ctx_t;
+
+static indirect_ctx_t *s_indirect;
+static ezb_timer_t s_indirect_timer;
+static ezb_timer_t s_indirect_release_timer;
+
+static inline bool time_reached(uint32_t now, uint32_t time)
+{
+    return (int32_t)(now - time) >= 0;
+}
+
+/* A request held by the stack for a child that received nothing for this long has expired in the stack. */
+static uint32_t indirect_stack_persistence(void)
+{
+    uint32_t us;
+
+    /* The getter is marked experimental, the value only bounds the slots of the stack. */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wattribute-warning"
+    us = ezb_mac_get_transaction_persistence_time();
+#pragma GCC diagnostic pop
+    return us / 1000U;
+}
+
+/* The kind of a request, coalescing replaces a queued request of the same kind. ZDO requests have no kind. */
+static bool indirect_kind(const ezb_apsde_data_req_t *req, uint64_t *kind)
+{
+    uint8_t frame_control;
+    uint8_t cmd_offset;
+
+    if (req->dst_endpoint == 0) {
+        return false;
+    }
+    *kind = ((uint64_t)req->dst_endpoint << 48) | ((uint64_t)req->cluster_id << 32);
+    if (!req->asdu || req->asdu_length < 3) {
+        return true;
+    }
+    frame_control = req->asdu[0];
+    cmd_offset = 2;
+    if (frame_control & ZCL_FRAME_CONTROL_MANUF_SPECIFIC) {
+        if (req->asdu_length < 5) {
+            return true;
+        }
+        *kind |= ((uint64_t)req->asdu[1] << 16) | ((uint64_t)req->asdu[2] << 24);
+        cmd_offset = 4;
+    }
+    *kind |= (uint64_t)(frame_control & (ZCL_FRAME_CONTROL_FRAME_TYPE | ZCL_FRAME_CONTROL_MANUF_SPECIFIC |
+                                         ZCL_FRAME_CONTROL_DIRECTION)) << 8;
+    *kind |= req->asdu[cmd_offset];
+    return true;
+}
+
+static bool indirect_resolve_sleepy_child(const ezb_address_t *dst, ezb_shortaddr_t *addr)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_neighbor_info_t nbr = {};
+
+    if (dst->addr_mode != EZB_ADDR_MODE_SHORT && dst->addr_mode != EZB_ADDR_MODE_EXT) {
+        return false;
+    }
+    while (ezb_nwk_get_next_neighbor(&itor, &nbr) == EZB_ERR_NONE) {
+        if (!ezb_address_is_short(dst, nbr.short_addr) && !ezb_address_is_extended(dst, nbr.ieee_addr)) {
+            continue;
+        }
+        *addr = nbr.short_addr;
+        return nbr.relationship == EZB_NWK_RELATIONSHIP_CHILD && !nbr.rx_on_when_idle;
+    }
+    return false;
+}
+
+static indirect_child_t *indirect_find_child(ezb_shortaddr_t addr, bool alloc)
+{
+    indirect_child_t *slot = NULL;
+
+    for (uint8_t i = 0; i < s_indirect->config.max_children; i++) {
+        indirect_child_t *child = &s_indirect->children[i];
+        if (child->addr == addr) {
+            return child;
+        }
+        /* Reuse the queue of a child that has nothing pending. */
+        if (!slot && (child->addr == EZB_NWK_ADDR_UNKNOWN || (!child->stats.depth && !child->in_stack))) {
+            slot = child;
+        }
+    }
+    if (!alloc || !slot) {
+        return NULL;
+    }
+    slot->addr = addr;
+    slot->in_stack = 0;
+    slot->release_pending = false;
+    memset(&slot->stats, 0, sizeof(slot->stats));
+    return slot;
+}
+
+static void indirect_entry_free(indirect_child_t *child, indirect_entry_t *entry)
+{
+    free(entry->req.asdu);
+    entry->req.asdu = NULL;
+    entry->used = false;
+    child->stats.depth--;
+}
+
+static void indirect_purge(indirect_child_t *child, uint32_t now)
+{
+    for (uint8_t i = 0; i < s_indirect->config.depth; i++) {
+        indirect_entry_t *entry = &child->entries[i];
+        if (entry->used && time_reached(now, entry->expiry)) {
+            indirect_entry_free(child, entry);
+            child->stats.expired++;
+        }
+    }
+}
+
+/* The next request to release: the highest priority, then the oldest. */
+static indirect_entry_t *indirect_next(indirect_child_t *child)
+{
+    indirect_entry_t *next = NULL;
+
+    for (uint8_t i = 0; i < s_indirect->config.depth; i++) {
+        indirect_entry_t *entry = &child->entries[i];
+        if (!entry->used) {
+            continue;
+        }
+        if (!next || entry->priority > next->priority ||
+            (entry->priority == next->priority && (int32_t)(entry->order - next->order) < 0)) {
+            next = entry;
+        }
+    }
+    return next;
+}
+
+/* The request to discard when the queue is full: the lowest priority, then the oldest. */
+static indirect_entry_t *indirect_victim(indirect_child_t *child)
+{
+    indirect_entry_t *victim = NULL;
+
+    for (uint8_t i = 0; i < s_indirect->config.depth; i++) {
+        indirect_entry_t *entry = &child->entries[i];
+        if (!victim || entry->priority < victim->priority ||
+            (entry->priority == victim->priority && (int32_t)(entry->order - victim->order) < 0)) {
+            victim = entry;
+        }
+    }
+    return victim;
+}
+
+/* Hand the queued requests over to the stack, up to burst of them held by the stack at a time. The stack then
+ * sets the frame pending bit of the child itself, since it really holds a frame for it. */
+static void indirect_release_child(indirect_child_t *child, uint32_t now)
+{
+    child->release_pending = false;
+    indirect_purge(child, now);
+    while (child->in_stack < s_indirect->config.burst) {
+        indirect_entry_t *entry = indirect_next(child);
+        if (!entry) {
+            break;
+        }
+        if (ezb_apsde_data_request(&entry->req) == EZB_ERR_NONE) {
+            child->stats.released++;
+            child->in_stack++;
+            child->last_activity = now;
+        } else {
+            child->stats.dropped++;
+        }
+        indirect_entry_free(child, entry);
+    }
+}
+
+static void indirect_release(void *ctx)
+{
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+
+    for (uint8_t i = 0; i < s_indirect->config.max_children; i++) {
+        if (s_indirect->children[i].release_pending) {
+            indirect_release_child(&s_indirect->children[i], now);
+        }
+    }
+}
+
+static void indirect_radio_rx(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr)
+{
+    indirect_child_t *child;
+
+    if (mhr->type != EZB_MAC_FRAME_TYPE_COMMAND || !mhr->payload_len ||
+        mhr->payload[0] != EZB_MAC_CMD_DATA_REQUEST || mhr->src.addr_mode != EZB_ADDR_MODE_SHORT) {
+        return;
+    }
+    child = indirect_find_child(mhr->src.u.short_addr, false);
+    if (child) {
+        child->stats.polls++;
+    }
+}
+
+static void indirect_radio_tx_done(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr,
+                                   const ezb_radio_frame_t *ack, ezb_err_t error)
+{
+    indirect_child_t *child;
+
+    /* A frame that was not acknowledged is retried or expires in the stack, only a delivered one frees a slot. */
+    if (mhr->type != EZB_MAC_FRAME_TYPE_DATA || mhr->dst.addr_mode != EZB_ADDR_MODE_SHORT || error != EZB_ERR_NONE) {
+        return;
+    }
+    child = indirect_find_child(mhr->dst.u.short_addr, false);
+    if (!child || !child->in_stack) {
+        return;
+    }
+    /* A data frame delivered to the child frees a slot of the stack, the frames of the stack itself included. */
+    child->in_stack--;
+    child->last_activity = ezb_plat_milli_alarm_get_now();
+    if (child->stats.depth && !child->release_pending) {
+        /* Requests must not be submitted from the radio hook. */
+        child->release_pending = true;
+        ezb_timer_start(&s_indirect_release_timer, 0);
+    }
+}
+
+static void indirect_tick(void *ctx)
+{
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+    uint32_t persistence = indirect_stack_persistence();
+
+    for (uint8_t i = 0; i < s_indirect->config.max_children; i++) {
+        indirect_child_t *child = &s_indirect->children[i];
+        /* The requests the stack never sent have expired in the stack, their slots are free again. */
+        if (child->in_stack && time_reached(now, child->last_activity + persistence)) {
+            child->in_stack = 0;
+        }
+        if (child->stats.depth) {
+            indirect_release_child(child, now);
+        }
+    }
+    ezb_timer_start(&s_indirect_timer, INDIRECT_PURGE_INTERVAL_MS);
+}
+
+ezb_err_t ezb_aps_indirect_queue_init(const ezb_aps_indirect_queue_config_t *config)
+{
+    if (!config || !config->max_children || !config->depth || !config->burst || !config->expiry) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_indirect) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_indirect = calloc(1, sizeof(indirect_ctx_t));
+    if (!s_indirect) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_indirect->children = calloc(config->max_children, sizeof(indirect_child_t));
+    if (!s_indirect->children) {
+        goto error;
+    }
+    for (uint8_t i = 0; i < config->max_children; i++) {
+        s_indirect->children[i].addr = EZB_NWK_ADDR_UNKNOWN;
+        s_indirect->children[i].entries = calloc(config->depth, sizeof(indirect_entry_t));
+        if (!s_indirect->children[i].entries) {
+            goto error;
+        }
+    }
+    if (!ezb_timer_init(&s_indirect_timer, "zb_indq", indirect_tick, NULL)) {
+        goto error;
+    }
+    if (!ezb_timer_init(&s_indirect_release_timer, "zb_indq_rel", indirect_release, NULL)) {
+        ezb_timer_deinit(&s_indirect_timer);
+        goto error;
+    }
+
+    s_indirect->config = *config;
+    s_indirect->hook.rx = indirect_radio_rx;
+    s_indirect->hook.tx_done = indirect_radio_tx_done;
+    ezb_mac_radio_hook_register(&s_indirect->hook);
+    ezb_timer_start(&s_indirect_timer, INDIRECT_PURGE_INTERVAL_MS);
+    return EZB_ERR_NONE;
+
+error:
+    if (s_indirect->children) {
+        for (uint8_t i = 0; i < config->max_children; i++) {
+            free(s_indirect->children[i].entries);
+        }
+    }
+    free(s_indirect->children);
+    free(s_indirect);
+    s_indirect = NULL;
+    return EZB_ERR_NO_MEM;
+}
+
+void ezb_aps_indirect_queue_deinit(void)
+{
+    if (!s_indirect) {
+        return;
+    }
+    ezb_timer_deinit(&s_indirect_timer);
+    ezb_timer_deinit(&s_indirect_release_timer);
+    ezb_mac_radio_hook_unregister(&s_indirect->hook);
+    for (uint8_t i = 0; i < s_indirect->config.max_children; i++) {
+        indirect_child_t *child = &s_indirect->children[i];
+        for (uint8_t n = 0; n < s_indirect->config.depth; n++) {
+            if (child->entries[n].used) {
+                indirect_entry_free(child, &child->entries[n]);
+            }
+        }
+        free(child->entries);
+    }
+    free(s_indirect->children);
+    free(s_indirect);
+    s_indirect = NULL;
+}
+
+ezb_err_t ezb_aps_indirect_queue_submit(const ezb_apsde_data_req_t *req, uint8_t priority, bool coalesce)
+{
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+    indirect_entry_t *entry = NULL;
+    indirect_child_t *child;
+    ezb_shortaddr_t addr;
+    uint64_t kind = 0;
+    uint8_t *asdu = NULL;
+
+    if (!req || (req->asdu_length && !req->asdu)) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_indirect) {
+        return EZB_ERR_INV_STATE;
+    }
+    if (!indirect_resolve_sleepy_child(&req->dst_address, &addr)) {
+        return ezb_apsde_data_request(req);
+    }
+    child = indirect_find_child(addr, true);
+    if (!child) {
+        return EZB_ERR_NO_MEM;
+    }
+    indirect_purge(child, now);
+
+    coalesce = coalesce && indirect_kind(req, &kind);
+    if (coalesce) {
+        for (uint8_t i = 0; i < s_indirect->config.depth; i++) {
+            if (child->entries[i].used && child->entries[i].kind == kind) {
+                entry = &child->entries[i];
+                break;
+            }
+        }
+    }
+    if (!entry) {
+        for (uint8_t i = 0; i < s_indirect->config.depth; i++) {
+            if (!child->entries[i].used) {
+                entry = &child->entries[i];
+                break;
+            }
+        }
+    }
+    if (!entry) {
+        entry = indirect_victim(child);
+        if (entry->priority >= priority) {
+            child->stats.dropped++;
+            return EZB_ERR_NO_MEM;
+        }
+    }
+
+    if (req->asdu_length) {
+        asdu = malloc(req->asdu_length);
+        if (!asdu) {
+            return EZB_ERR_NO_MEM;
+        }
+        memcpy(asdu, req->asdu, req->asdu_length);
+    }
+    if (entry->used) {
+        if (entry->kind == kind && coalesce) {
+            child->stats.coalesced++;
+        } else {
+            child->stats.dropped++;
+        }
+        free(entry->req.asdu);
+    } else {
+        entry->used = true;
+        child->stats.depth++;
+        if (child->stats.depth > child->stats.high_water) {
+            child->stats.high_water = child->stats.depth;
+        }
+    }
+    entry->req = *req;
+    entry->req.asdu = asdu;
+    entry->kind = kind;
+    entry->priority = priority;
+    entry->order = s_indirect->order++;
+    entry->expiry = now + s_indirect->config.expiry;
+    child->stats.queued++;
+    indirect_release_child(child, now);
+    return EZB_ERR_NONE;
+}
+
+ezb_err_t ezb_aps_indirect_queue_get_stats(ezb_shortaddr_t short_addr, ezb_aps_indirect_queue_stats_t *stats)
+{
+    indirect_child_t *child;
+
+    if (!stats) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_indirect || !(child = indirect_find_child(short_addr, false))) {
+        return EZB_ERR_NOT_FOUND;
+    }
+    *stats = child->stats;
+    return EZB_ERR_NONE;
+}
@@ -0,0 +1,230 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/platform/alarm.h>
+#include <ezbee/aps/aps_rtt.h>
+
+#include "aps/aps_hook.h"
+#include "utils/ezb_lru.h"
+
+typedef struct rtt_dest_s {
+    ezb_address_t addr;         /* EZB_ADDR_MODE_NONE if the entry is free */
+    uint32_t last_used;
+    ezb_aps_rtt_estimate_t estimate;
+} rtt_dest_t;
+
+typedef struct rtt_inflight_s {
+    ezb_address_t addr;         /* EZB_ADDR_MODE_NONE if the entry is free */
+    uint8_t src_endpoint;
+    uint8_t dst_endpoint;
+    uint16_t cluster_id;
+    uint32_t start;
+} rtt_inflight_t;
+
+typedef struct rtt_ctx_s {
+    ezb_aps_rtt_config_t config;
+    rtt_dest_t *dests;
+    rtt_inflight_t *inflight;
+    ezb_aps_hook_t hook;
+} rtt_ctx_t;
+
+static rtt_ctx_t *s_rtt;
+
+static bool rtt_is_timed(const ezb_address_t *addr, uint8_t tx_options)
+{
+    return (tx_options & EZB_APSDE_TX_OPT_ACK_TX) &&
+           (addr->addr_mode == EZB_ADDR_MODE_SHORT || addr->addr_mode == EZB_ADDR_MODE_EXT);
+}
+
+static uint32_t rtt_clamp(uint32_t timeout)
+{
+    if (timeout < s_rtt->config.min_timeout) {
+        return s_rtt->config.min_timeout;
+    }
+    return timeout > s_rtt->config.max_timeout ? s_rtt->config.max_timeout : timeout;
+}
+
+static bool rtt_dest_is_free(const void *entry)
+{
+    return ((const rtt_dest_t *)entry)->addr.addr_mode == EZB_ADDR_MODE_NONE;
+}
+
+static bool rtt_inflight_is_free(const void *entry)
+{
+    return ((const rtt_inflight_t *)entry)->addr.addr_mode == EZB_ADDR_MODE_NONE;
+}
+
+static rtt_dest_t *rtt_find(const ezb_address_t *addr)
+{
+    for (uint8_t i = 0; i < s_rtt->config.max_destinations; i++) {
+        if (s_rtt->dests[i].addr.addr_mode != EZB_ADDR_MODE_NONE && ezb_address_compare(&s_rtt->dests[i].addr, addr)) {
+            return &s_rtt->dests[i];
+        }
+    }
+    return NULL;
+}
+
+static rtt_dest_t *rtt_find_or_alloc(const ezb_address_t *addr, uint32_t now)
+{
+    rtt_dest_t *dest = rtt_find(addr);
+
+    if (!dest) {
+        dest = ezb_lru_select(s_rtt->dests, s_rtt->config.max_destinations, sizeof(rtt_dest_t),
+                              offsetof(rtt_dest_t, last_used), rtt_dest_is_free);
+        memset(dest, 0, sizeof(rtt_dest_t));
+        dest->addr = *addr;
+        dest->estimate.timeout = s_rtt->config.initial_timeout;
+    }
+    dest->last_used = now;
+    return dest;
+}
+
+/* RFC 6298, 2. The Basic Algorithm */
+static void rtt_sample(rtt_dest_t *dest, uint32_t rtt)
+{
+    ezb_aps_rtt_estimate_t *estimate = &dest->estimate;
+
+    if (!estimate->samples) {
+        estimate->srtt = rtt;
+        estimate->rttvar = rtt / 2;
+    } else {
+        uint32_t delta = estimate->srtt > rtt ? estimate->srtt - rtt : rtt - estimate->srtt;
+        estimate->rttvar = (3 * estimate->rttvar + delta) / 4;
+        estimate->srtt = (7 * estimate->srtt + rtt) / 8;
+    }
+    estimate->samples++;
+    estimate->timeout = rtt_clamp(estimate->srtt + 4 * estimate->rttvar);
+}
+
+static void rtt_aps_request(const ezb_apsde_data_req_t *req, ezb_err_t ret)
+{
+    rtt_inflight_t *slot;
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+
+    if (ret != EZB_ERR_NONE || !rtt_is_timed(&req->dst_address, req->tx_options)) {
+        return;
+    }
+    /* Take a free slot, or the oldest one, whose confirm is most likely lost. */
+    slot = ezb_lru_select(s_rtt->inflight, s_rtt->config.max_inflight, sizeof(rtt_inflight_t),
+                          offsetof(rtt_inflight_t, start), rtt_inflight_is_free);
+    rtt_find_or_alloc(&req->dst_address, now);
+    slot->addr = req->dst_address;
+    slot->src_endpoint = req->src_endpoint;
+    slot->dst_endpoint = req->dst_endpoint;
+    slot->cluster_id = req->cluster_id;
+    slot->start = now;
+}
+
+static void rtt_aps_confirm(const ezb_apsde_data_confirm_t *confirm)
+{
+    rtt_inflight_t *slot = NULL;
+    rtt_dest_t *dest;
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+
+    /* The confirms of the requests with the same parameters come in order, match the oldest request. */
+    for (uint8_t i = 0; i < s_rtt->config.max_inflight; i++) {
+        rtt_inflight_t *iter = &s_rtt->inflight[i];
+        if (iter->addr.addr_mode != EZB_ADDR_MODE_NONE && ezb_address_compare(&iter->addr, &confirm->dst_address) &&
+            iter->src_endpoint == confirm->src_endpoint && iter->dst_endpoint == confirm->dst_endpoint &&
+            iter->cluster_id == confirm->cluster_id && (!slot || (int32_t)(iter->start - slot->start) < 0)) {
+            slot = iter;
+        }
+    }
+    if (!slot) {
+        return;
+    }
+    slot->addr.addr_mode = EZB_ADDR_MODE_NONE;
+    dest = rtt_find(&confirm->dst_address);
+    if (!dest) {
+        return;
+    }
+    dest->last_used = now;
+    /* The retries of the stack are hidden in a failure, back off without sampling, see RFC 6298, 5.5. */
+    if (confirm->status != 0) {
+        dest->estimate.failures++;
+        dest->estimate.timeout = rtt_clamp(dest->estimate.timeout * 2);
+        return;
+    }
+    /* A confirm later than the APS acknowledgement wait may follow a retry of the stack, it is ambiguous which
+     * transmission it acknowledges: discard it, see Karn's algorithm, RFC 6298, 3. */
+    if (s_rtt->config.ack_wait && now - slot->start > s_rtt->config.ack_wait) {
+        dest->estimate.discarded++;
+        return;
+    }
+    rtt_sample(dest, now - slot->start);
+}
+
+ezb_err_t ezb_aps_rtt_init(const ezb_aps_rtt_config_t *config)
+{
+    if (!config || !config->max_destinations || !config->max_inflight || !config->min_timeout ||
+        config->min_timeout > config->max_timeout || config->initial_timeout < config->min_timeout ||
+        config->initial_timeout > config->max_timeout) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_rtt) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_rtt = calloc(1, sizeof(rtt_ctx_t));
+    if (!s_rtt) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_rtt->dests = calloc(config->max_destinations, sizeof(rtt_dest_t));
+    s_rtt->inflight = calloc(config->max_inflight, sizeof(rtt_inflight_t));
+    if (!s_rtt->dests || !s_rtt->inflight) {
+        free(s_rtt->inflight);
+        free(s_rtt->dests);
+        free(s_rtt);
+        s_rtt = NULL;
+        return EZB_ERR_NO_MEM;
+    }
+    s_rtt->config = *config;
+    s_rtt->hook.request = rtt_aps_request;
+    s_rtt->hook.confirm = rtt_aps_confirm;
+    ezb_aps_hook_register(&s_rtt->hook);
+    return EZB_ERR_NONE;
+}
+
+void ezb_aps_rtt_deinit(void)
+{
+    if (!s_rtt) {
+        return;
+    }
+    ezb_aps_hook_unregister(&s_rtt->hook);
+    free(s_rtt->inflight);
+    free(s_rtt->dests);
+    free(s_rtt);
+    s_rtt = NULL;
+}
+
+ezb_err_t ezb_aps_rtt_get_estimate(const ezb_address_t *dst_address, ezb_aps_rtt_estimate_t *estimate)
+{
+    rtt_dest_t *dest;
+
+    if (!dst_address || !estimate) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_rtt || !(dest = rtt_find(dst_address))) {
+        return EZB_ERR_NOT_FOUND;
+    }
+    *estimate = dest->estimate;
+    return EZB_ERR_NONE;
+}
+
+uint32_t ezb_aps_rtt_get_timeout(const ezb_address_t *dst_address)
+{
+    rtt_dest_t *dest;
+
+    if (!s_rtt) {
+        return 0;
+    }
+    dest = dst_address ? rtt_find(dst_address) : NULL;
+    return dest ? dest->estimate.timeout : s_rtt->config.initial_timeout;
+}
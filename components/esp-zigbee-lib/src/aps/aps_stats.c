@@ -0,0 +1,77 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <ezbee/aps/aps_stats.h>
+
+#include "aps/aps_hook.h"
+#include "mac/mac_frame.h"
+#include "utils/ezb_stats.h"
+
+static bool aps_stats_is_unicast(const ezb_address_t *addr)
+{
+    return addr->addr_mode == EZB_ADDR_MODE_EXT ||
+           (addr->addr_mode == EZB_ADDR_MODE_SHORT && !EZB_NWK_IS_BROADCAST_ADDR(addr->u.short_addr));
+}
+
+static void aps_stats_request(const ezb_apsde_data_req_t *req, ezb_err_t ret)
+{
+    if (ret == EZB_ERR_NO_MEM) {
+        EZB_STATS_INC(aps.buffer_alloc_failures);
+    } else if (ret == EZB_ERR_NONE && !aps_stats_is_unicast(&req->dst_address)) {
+        EZB_STATS_INC(aps.tx_bcast);
+    }
+}
+
+static bool aps_stats_indication(const ezb_apsde_data_ind_t *ind)
+{
+    if (aps_stats_is_unicast(&ind->dst_address)) {
+        EZB_STATS_INC(aps.rx_ucast);
+    } else {
+        EZB_STATS_INC(aps.rx_bcast);
+    }
+    return false;
+}
+
+static void aps_stats_confirm(const ezb_apsde_data_confirm_t *confirm)
+{
+    if (!aps_stats_is_unicast(&confirm->dst_address)) {
+        return;
+    }
+    if (confirm->status == 0) {
+        EZB_STATS_INC(aps.tx_ucast_success);
+    } else {
+        EZB_STATS_INC(aps.tx_ucast_fail);
+    }
+}
+
+static ezb_aps_hook_t s_aps_stats_hook = {
+    .request = aps_stats_request,
+    .indication = aps_stats_indication,
+    .confirm = aps_stats_confirm,
+};
+
+void ezb_aps_stats_enable(bool enable)
+{
+    if (enable) {
+        ezb_aps_hook_register(&s_aps_stats_hook);
+    } else {
+        ezb_aps_hook_unregister(&s_aps_stats_hook);
+    }
+}
+
+void ezb_aps_get_stats(ezb_aps_stats_t *stats)
+{
+    if (stats) {
+        *stats = g_ezb_stats.aps;
+    }
+}
+
+void ezb_aps_reset_stats(void)
+{
+    memset(&g_ezb_stats.aps, 0, sizeof(ezb_aps_stats_t));
+}
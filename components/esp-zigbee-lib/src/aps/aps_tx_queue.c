@@ -0,0 +1,317 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/aps/aps_tx_queue.h>
+
+#include "utils/ezb_timer.h"
+
+/* The classes served by weighted round robin, after the control class */
+#define TX_QUEUE_WEIGHTED_FIRST EZB_APS_TRAFFIC_CLASS_INTERACTIVE
+#define TX_QUEUE_WEIGHTED_COUNT (EZB_APS_TRAFFIC_CLASS_MAX - TX_QUEUE_WEIGHTED_FIRST)
+
+typedef struct tx_queue_entry_s {
+    ezb_apsde_data_req_t req;       /* The ASDU points to the owned copy, unused when send is set */
+    ezb_aps_tx_queue_send_t send;
+    void *user_ctx;
+} tx_queue_entry_t;
+
+typedef struct tx_queue_class_s {
+    tx_queue_entry_t *entries;      /* FIFO of depth entries */
+    uint8_t head;
+} tx_queue_class_t;
+
+typedef struct tx_queue_ctx_s {
+    ezb_aps_tx_queue_config_t config;
+    ezb_aps_tx_queue_class_stats_t stats[EZB_APS_TRAFFIC_CLASS_MAX];
+    tx_queue_class_t classes[EZB_APS_TRAFFIC_CLASS_MAX];
+    uint8_t budget;                 /* Weighted requests left to release in this interval */
+    uint8_t control_budget;         /* Control requests left to release in this interval */
+    uint8_t current;                /* Weighted class of the current round robin turn */
+    uint8_t credits;                /* Requests left to the current class in its turn */
+    bool blocked;                   /* The stack is out of buffers until the next interval */
+} tx_queue_ctx_t;
+
+static tx_queue_ctx_t *s_txq;
+static ezb_timer_t s_txq_timer;
+
+static inline bool tx_queue_out_of_buffers(ezb_err_t ret)
+{
+    return ret == EZB_ERR_NO_MEM || ret == EZB_ERR_BUSY;
+}
+
+static void tx_queue_pop(ezb_aps_traffic_class_t traffic_class)
+{
+    tx_queue_class_t *queue = &s_txq->classes[traffic_class];
+    ezb_aps_tx_queue_class_stats_t *stats = &s_txq->stats[traffic_class];
+
+    free(queue->entries[queue->head].req.asdu);
+    memset(&queue->entries[queue->head], 0, sizeof(tx_queue_entry_t));
+    queue->head = (queue->head + 1) % s_txq->config.classes[traffic_class].depth;
+    stats->queued--;
+    if (stats->congested && stats->queued <= s_txq->config.classes[traffic_class].low_watermark) {
+        stats->congested = false;
+        if (s_txq->config.pressure_cb) {
+            s_txq->config.pressure_cb(traffic_class, false);
+        }
+    }
+}
+
+static ezb_err_t tx_queue_push(const ezb_apsde_data_req_t *req, ezb_aps_tx_queue_send_t send, void *user_ctx,
+                               ezb_aps_traffic_class_t traffic_class)
+{
+    tx_queue_class_t *queue = &s_txq->classes[traffic_class];
+    ezb_aps_tx_queue_class_stats_t *stats = &s_txq->stats[traffic_class];
+    const ezb_aps_tx_queue_class_config_t *config = &s_txq->config.classes[traffic_class];
+    tx_queue_entry_t *entry;
+    uint8_t *asdu = NULL;
+
+    if (stats->queued == config->depth) {
+        stats->rejected++;
+        return EZB_ERR_BUSY;
+    }
+    if (req && req->asdu_length) {
+        asdu = malloc(req->asdu_length);
+        if (!asdu) {
+            return EZB_ERR_NO_MEM;
+        }
+        memcpy(asdu, req->asdu, req->asdu_length);
+    }
+
+    entry = &queue->entries[(queue->head + stats->queued) % config->depth];
+    if (req) {
+        entry->req = *req;
+        entry->req.asdu = asdu;
+    }
+    entry->send = send;
+    entry->user_ctx = user_ctx;
+    stats->queued++;
+    if (!stats->congested && stats->queued >= config->high_watermark) {
+        stats->congested = true;
+        if (s_txq->config.pressure_cb) {
+            s_txq->config.pressure_cb(traffic_class, true);
+        }
+    }
+    return EZB_ERR_NONE;
+}
+
+/* Release the request at the head of a class, return false if the stack is out of buffers. */
+static bool tx_queue_release(ezb_aps_traffic_class_t traffic_class)
+{
+    tx_queue_entry_t *entry = &s_txq->classes[traffic_class].entries[s_txq->classes[traffic_class].head];
+    ezb_err_t ret = entry->send ? entry->send(entry->user_ctx) : ezb_apsde_data_request(&entry->req);
+
+    if (tx_queue_out_of_buffers(ret)) {
+        s_txq->stats[traffic_class].deferred++;
+        s_txq->blocked = true;
+        return false;
+    }
+    if (ret == EZB_ERR_NONE) {
+        s_txq->stats[traffic_class].released++;
+    } else {
+        s_txq->stats[traffic_class].failed++;
+    }
+    tx_queue_pop(traffic_class);
+    return true;
+}
+
+/* The weighted class whose turn it is, EZB_APS_TRAFFIC_CLASS_MAX if none has a request. */
+static ezb_aps_traffic_class_t tx_queue_pick(void)
+{
+    for (uint8_t i = 0; i <= TX_QUEUE_WEIGHTED_COUNT; i++) {
+        if (s_txq->credits && s_txq->stats[s_txq->current].queued) {
+            return s_txq->current;
+        }
+        s_txq->current = TX_QUEUE_WEIGHTED_FIRST +
+                         (s_txq->current - TX_QUEUE_WEIGHTED_FIRST + 1) % TX_QUEUE_WEIGHTED_COUNT;
+        s_txq->credits = s_txq->config.classes[s_txq->current].weight;
+    }
+    return EZB_APS_TRAFFIC_CLASS_MAX;
+}
+
+static bool tx_queue_weighted_is_empty(void)
+{
+    for (uint8_t i = TX_QUEUE_WEIGHTED_FIRST; i < EZB_APS_TRAFFIC_CLASS_MAX; i++) {
+        if (s_txq->stats[i].queued) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static void tx_queue_arm(void)
+{
+    if (!ezb_timer_is_armed(&s_txq_timer) &&
+        (s_txq->blocked || s_txq->budget < s_txq->config.burst ||
+         s_txq->control_budget < s_txq->config.control_burst || s_txq->stats[EZB_APS_TRAFFIC_CLASS_CONTROL].queued ||
+         !tx_queue_weighted_is_empty())) {
+        ezb_timer_start(&s_txq_timer, s_txq->config.interval);
+    }
+}
+
+static void tx_queue_schedule(void)
+{
+    ezb_aps_traffic_class_t traffic_class;
+
+    while (!s_txq->blocked) {
+        if (s_txq->control_budget && s_txq->stats[EZB_APS_TRAFFIC_CLASS_CONTROL].queued) {
+            if (tx_queue_release(EZB_APS_TRAFFIC_CLASS_CONTROL)) {
+                s_txq->control_budget--;
+            }
+            continue;
+        }
+        if (!s_txq->budget || (traffic_class = tx_queue_pick()) == EZB_APS_TRAFFIC_CLASS_MAX) {
+            break;
+        }
+        if (tx_queue_release(traffic_class)) {
+            s_txq->credits--;
+            s_txq->budget--;
+        }
+    }
+    tx_queue_arm();
+}
+
+static void tx_queue_interval(void *ctx)
+{
+    s_txq->budget = s_txq->config.burst;
+    s_txq->control_budget = s_txq->config.control_burst;
+    s_txq->blocked = false;
+    tx_queue_schedule();
+}
+
+ezb_err_t ezb_aps_tx_queue_init(const ezb_aps_tx_queue_config_t *config)
+{
+    bool allocated = true;
+
+    if (!config || !config->burst || !config->control_burst || !config->interval) {
+        return EZB_ERR_INV_ARG;
+    }
+    for (uint8_t i = 0; i < EZB_APS_TRAFFIC_CLASS_MAX; i++) {
+        const ezb_aps_tx_queue_class_config_t *class_config = &config->classes[i];
+        if (!class_config->depth || !class_config->high_watermark ||
+            class_config->high_watermark > class_config->depth ||
+            class_config->low_watermark >= class_config->high_watermark ||
+            (i >= TX_QUEUE_WEIGHTED_FIRST && !class_config->weight)) {
+            return EZB_ERR_INV_ARG;
+        }
+    }
+    if (s_txq) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_txq = calloc(1, sizeof(tx_queue_ctx_t));
+    if (!s_txq) {
+        return EZB_ERR_NO_MEM;
+    }
+    for (uint8_t i = 0; i < EZB_APS_TRAFFIC_CLASS_MAX; i++) {
+        s_txq->classes[i].entries = calloc(config->classes[i].depth, sizeof(tx_queue_entry_t));
+        allocated = allocated && s_txq->classes[i].entries;
+    }
+    if (!allocated || !ezb_timer_init(&s_txq_timer, "zb_txq", tx_queue_interval, NULL)) {
+        for (uint8_t i = 0; i < EZB_APS_TRAFFIC_CLASS_MAX; i++) {
+            free(s_txq->classes[i].entries);
+        }
+        free(s_txq);
+        s_txq = NULL;
+        return EZB_ERR_NO_MEM;
+    }
+    s_txq->config = *config;
+    s_txq->budget = config->burst;
+    s_txq->control_budget = config->control_burst;
+    s_txq->current = TX_QUEUE_WEIGHTED_FIRST;
+    s_txq->credits = config->classes[TX_QUEUE_WEIGHTED_FIRST].weight;
+    return EZB_ERR_NONE;
+}
+
+void ezb_aps_tx_queue_deinit(void)
+{
+    if (!s_txq) {
+        return;
+    }
+    ezb_timer_deinit(&s_txq_timer);
+    /* The queues are discarded silently, without back-pressure signal. */
+    s_txq->config.pressure_cb = NULL;
+    for (uint8_t i = 0; i < EZB_APS_TRAFFIC_CLASS_MAX; i++) {
+        while (s_txq->stats[i].queued) {
+            tx_queue_pop(i);
+        }
+        free(s_txq->classes[i].entries);
+    }
+    free(s_txq);
+    s_txq = NULL;
+}
+
+static ezb_err_t tx_queue_submit(const ezb_apsde_data_req_t *req, ezb_aps_tx_queue_send_t send, void *user_ctx,
+                                 ezb_aps_traffic_class_t traffic_class)
+{
+    bool weighted = traffic_class != EZB_APS_TRAFFIC_CLASS_CONTROL;
+    ezb_err_t ret;
+
+    s_txq->stats[traffic_class].submitted++;
+    /* Send at once when nothing is queued ahead of the request, it is queued only if the stack has no buffer. */
+    if (!s_txq->blocked && !s_txq->stats[EZB_APS_TRAFFIC_CLASS_CONTROL].queued &&
+        (weighted ? s_txq->budget && tx_queue_weighted_is_empty() : s_txq->control_budget)) {
+        ret = send ? send(user_ctx) : ezb_apsde_data_request(req);
+        if (!tx_queue_out_of_buffers(ret)) {
+            if (ret == EZB_ERR_NONE) {
+                s_txq->stats[traffic_class].released++;
+                if (weighted) {
+                    s_txq->budget--;
+                } else {
+                    s_txq->control_budget--;
+                }
+            } else {
+                s_txq->stats[traffic_class].failed++;
+            }
+            tx_queue_arm();
+            return ret;
+        }
+        s_txq->stats[traffic_class].deferred++;
+        s_txq->blocked = true;
+    }
+
+    ret = tx_queue_push(req, send, user_ctx, traffic_class);
+    if (ret == EZB_ERR_NONE) {
+        tx_queue_schedule();
+    }
+    return ret;
+}
+
+ezb_err_t ezb_aps_tx_queue_data_request(const ezb_apsde_data_req_t *req, ezb_aps_traffic_class_t traffic_class)
+{
+    if (!req || (req->asdu_length && !req->asdu) || traffic_class >= EZB_APS_TRAFFIC_CLASS_MAX) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_txq) {
+        return EZB_ERR_INV_STATE;
+    }
+    return tx_queue_submit(req, NULL, NULL, traffic_class);
+}
+
+ezb_err_t ezb_aps_tx_queue_send(ezb_aps_tx_queue_send_t send, void *user_ctx, ezb_aps_traffic_class_t traffic_class)
+{
+    if (!send || traffic_class >= EZB_APS_TRAFFIC_CLASS_MAX) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_txq) {
+        return EZB_ERR_INV_STATE;
+    }
+    return tx_queue_submit(NULL, send, user_ctx, traffic_class);
+}
+
+void ezb_aps_tx_queue_get_stats(ezb_aps_traffic_class_t traffic_class, ezb_aps_tx_queue_class_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_txq || traffic_class >= EZB_APS_TRAFFIC_CLASS_MAX) {
+        memset(stats, 0, sizeof(ezb_aps_tx_queue_class_stats_t));
+        return;
+    }
+    *stats = s_txq->stats[traffic_class];
+}
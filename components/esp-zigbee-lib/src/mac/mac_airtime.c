@@ -0,0 +1,233 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/platform/alarm.h>
+#include <ezbee/platform/radio.h>
+#include <ezbee/mac/mac_airtime.h>
+
+#include "mac/mac_radio_hook.h"
+#include "utils/ezb_lru.h"
+
+/* Preamble (4), SFD (1) and PHR (1), IEEE 802.15.4-2015, 12.1 PPDU format */
+#define AIRTIME_PHY_OVERHEAD 6U
+#define AIRTIME_US(length)   ((AIRTIME_PHY_OVERHEAD + (length)) * EZB_RADIO_SYMBOLS_PER_OCTET * EZB_RADIO_SYMBOL_TIME)
+
+#define AIRTIME_MINUTE_BUCKETS   6U
+#define AIRTIME_MINUTE_BUCKET_MS 10000U
+#define AIRTIME_HOUR_BUCKETS     12U
+#define AIRTIME_HOUR_BUCKET_MS   300000U
+
+enum {
+    AIRTIME_TX = 0,
+    AIRTIME_RX = 1,
+};
+
+typedef struct airtime_counters_s {
+    uint32_t minute_slot;       /* The bucket period of the current minute bucket */
+    uint32_t hour_slot;
+    uint32_t minute[2][AIRTIME_MINUTE_BUCKETS];
+    uint32_t hour[2][AIRTIME_HOUR_BUCKETS];
+} airtime_counters_t;
+
+typedef struct airtime_device_s {
+    ezb_address_t addr;         /* EZB_ADDR_MODE_NONE if the entry is free */
+    uint32_t last_seen;
+    airtime_counters_t counters;
+} airtime_device_t;
+
+typedef struct airtime_ctx_s {
+    ezb_mac_airtime_config_t config;
+    airtime_counters_t local;
+    airtime_device_t *devices;
+    ezb_mac_radio_hook_t hook;
+} airtime_ctx_t;
+
+static airtime_ctx_t *s_airtime;
+
+static void airtime_rotate_buckets(uint32_t *tx, uint32_t *rx, uint8_t count, uint32_t *current, uint32_t slot)
+{
+    uint32_t elapsed = slot - *current;
+
+    /* Clear the buckets of the periods elapsed since the last update, all of them after a long idle time. */
+    for (uint32_t i = 1; i <= elapsed && i <= count; i++) {
+        tx[(*current + i) % count] = 0;
+        rx[(*current + i) % count] = 0;
+    }
+    *current = slot;
+}
+
+static void airtime_rotate(airtime_counters_t *counters, uint32_t now)
+{
+    airtime_rotate_buckets(counters->minute[AIRTIME_TX], counters->minute[AIRTIME_RX], AIRTIME_MINUTE_BUCKETS,
+                           &counters->minute_slot, now / AIRTIME_MINUTE_BUCKET_MS);
+    airtime_rotate_buckets(counters->hour[AIRTIME_TX], counters->hour[AIRTIME_RX], AIRTIME_HOUR_BUCKETS,
+                           &counters->hour_slot, now / AIRTIME_HOUR_BUCKET_MS);
+}
+
+static void airtime_add(airtime_counters_t *counters, uint8_t dir, uint32_t us, uint32_t now)
+{
+    airtime_rotate(counters, now);
+    counters->minute[dir][counters->minute_slot % AIRTIME_MINUTE_BUCKETS] += us;
+    counters->hour[dir][counters->hour_slot % AIRTIME_HOUR_BUCKETS] += us;
+}
+
+static void airtime_sum(airtime_counters_t *counters, uint32_t now, ezb_mac_airtime_t *airtime)
+{
+    memset(airtime, 0, sizeof(ezb_mac_airtime_t));
+    airtime_rotate(counters, now);
+    for (uint8_t i = 0; i < AIRTIME_MINUTE_BUCKETS; i++) {
+        airtime->tx_minute += counters->minute[AIRTIME_TX][i];
+        airtime->rx_minute += counters->minute[AIRTIME_RX][i];
+    }
+    for (uint8_t i = 0; i < AIRTIME_HOUR_BUCKETS; i++) {
+        airtime->tx_hour += counters->hour[AIRTIME_TX][i];
+        airtime->rx_hour += counters->hour[AIRTIME_RX][i];
+    }
+}
+
+static void airtime_counters_reset(airtime_counters_t *counters, uint32_t now)
+{
+    memset(counters, 0, sizeof(airtime_counters_t));
+    counters->minute_slot = now / AIRTIME_MINUTE_BUCKET_MS;
+    counters->hour_slot = now / AIRTIME_HOUR_BUCKET_MS;
+}
+
+static bool airtime_device_is_free(const void *entry)
+{
+    return ((const airtime_device_t *)entry)->addr.addr_mode == EZB_ADDR_MODE_NONE;
+}
+
+static airtime_device_t *airtime_find_or_alloc(const ezb_address_t *addr, uint32_t now)
+{
+    airtime_device_t *victim;
+
+    if (addr->addr_mode != EZB_ADDR_MODE_SHORT && addr->addr_mode != EZB_ADDR_MODE_EXT) {
+        return NULL;
+    }
+    if (addr->addr_mode == EZB_ADDR_MODE_SHORT && addr->u.short_addr >= EZB_RADIO_INVALID_SHORT_ADDR) {
+        return NULL;
+    }
+    for (uint16_t i = 0; i < s_airtime->config.max_devices; i++) {
+        airtime_device_t *device = &s_airtime->devices[i];
+        if (device->addr.addr_mode != EZB_ADDR_MODE_NONE && ezb_address_compare(&device->addr, addr)) {
+            device->last_seen = now;
+            return device;
+        }
+    }
+    victim = ezb_lru_select(s_airtime->devices, s_airtime->config.max_devices, sizeof(airtime_device_t),
+                            offsetof(airtime_device_t, last_seen), airtime_device_is_free);
+    victim->addr = *addr;
+    victim->last_seen = now;
+    airtime_counters_reset(&victim->counters, now);
+    return victim;
+}
+
+static void airtime_account(uint8_t dir, const ezb_address_t *addr, uint8_t length, uint32_t now)
+{
+    airtime_device_t *device = airtime_find_or_alloc(addr, now);
+    uint32_t us = AIRTIME_US(length);
+
+    airtime_add(&s_airtime->local, dir, us, now);
+    if (device) {
+        airtime_add(&device->counters, dir, us, now);
+    }
+}
+
+static void airtime_radio_rx(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr)
+{
+    airtime_account(AIRTIME_RX, &mhr->src, frame->length, ezb_plat_milli_alarm_get_now());
+}
+
+static void airtime_radio_tx_done(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr,
+                                  const ezb_radio_frame_t *ack, ezb_err_t error)
+{
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+
+    /* Nothing is sent on a channel access failure. */
+    if (error != EZB_ERR_NONE && error != EZB_ERR_MAC_NO_ACK) {
+        return;
+    }
+    airtime_account(AIRTIME_TX, &mhr->dst, frame->length, now);
+    if (ack) {
+        airtime_account(AIRTIME_RX, &mhr->dst, ack->length, now);
+    }
+}
+
+ezb_err_t ezb_mac_airtime_init(const ezb_mac_airtime_config_t *config)
+{
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+
+    if (!config || !config->max_devices) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_airtime) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_airtime = calloc(1, sizeof(airtime_ctx_t));
+    if (!s_airtime) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_airtime->devices = calloc(config->max_devices, sizeof(airtime_device_t));
+    if (!s_airtime->devices) {
+        free(s_airtime);
+        s_airtime = NULL;
+        return EZB_ERR_NO_MEM;
+    }
+    s_airtime->config = *config;
+    airtime_counters_reset(&s_airtime->local, now);
+    s_airtime->hook.rx = airtime_radio_rx;
+    s_airtime->hook.tx_done = airtime_radio_tx_done;
+    ezb_mac_radio_hook_register(&s_airtime->hook);
+    return EZB_ERR_NONE;
+}
+
+void ezb_mac_airtime_deinit(void)
+{
+    if (!s_airtime) {
+        return;
+    }
+    ezb_mac_radio_hook_unregister(&s_airtime->hook);
+    free(s_airtime->devices);
+    free(s_airtime);
+    s_airtime = NULL;
+}
+
+ezb_err_t ezb_mac_airtime_get_local(ezb_mac_airtime_t *airtime)
+{
+    if (!airtime) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_airtime) {
+        return EZB_ERR_INV_STATE;
+    }
+    airtime_sum(&s_airtime->local, ezb_plat_milli_alarm_get_now(), airtime);
+    return EZB_ERR_NONE;
+}
+
+ezb_err_t ezb_mac_airtime_get_next_device(uint16_t *index, ezb_mac_airtime_device_t *device)
+{
+    if (!index || !device) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_airtime) {
+        return EZB_ERR_NOT_FOUND;
+    }
+    for (; *index < s_airtime->config.max_devices; (*index)++) {
+        airtime_device_t *entry = &s_airtime->devices[*index];
+        if (entry->addr.addr_mode != EZB_ADDR_MODE_NONE) {
+            device->addr = entry->addr;
+            airtime_sum(&entry->counters, ezb_plat_milli_alarm_get_now(), &device->airtime);
+            (*index)++;
+            return EZB_ERR_NONE;
+        }
+    }
+    return EZB_ERR_NOT_FOUND;
+}
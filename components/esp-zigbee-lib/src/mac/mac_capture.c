@@ -0,0 +1,292 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+
+#include <ezbee/platform/radio.h>
+#include <ezbee/mac/mac_capture.h>
+
+#include "mac/mac_radio_hook.h"
+
+#define CAPTURE_IDLE_MS 1000U
+
+/* pcapng, draft-ietf-opsawg-pcapng */
+#define PCAPNG_BLOCK_SHB       0x0A0D0D0AU
+#define PCAPNG_BLOCK_IDB       0x00000001U
+#define PCAPNG_BLOCK_EPB       0x00000006U
+#define PCAPNG_BYTE_ORDER      0x1A2B3C4DU
+#define PCAPNG_LINKTYPE_TAP    283U         /* LINKTYPE_IEEE802_15_4_TAP */
+#define PCAPNG_SHB_SIZE        28U
+#define PCAPNG_IDB_SIZE        20U
+#define PCAPNG_EPB_HEADER_SIZE 28U
+#define PCAPNG_EPB_MAX_SIZE    (PCAPNG_EPB_HEADER_SIZE + TAP_HEADER_MAX_SIZE + EZB_RADIO_FRAME_MAX_SIZE + 3U + 4U)
+
+/* IEEE 802.15.4 TAP, https://github.com/jkcko/ieee802.15.4-tap */
+#define TAP_TLV_FCS_TYPE       0U
+#define TAP_TLV_RSS            1U
+#define TAP_TLV_CHANNEL        3U
+#define TAP_TLV_LQI            10U
+#define TAP_FCS_TYPE_NONE      0U
+#define TAP_HEADER_MAX_SIZE    (4U + 4U * 8U)
+
+#define PAD4(len) (((len) + 3U) & ~3U)
+
+typedef struct capture_slot_s {
+    uint64_t timestamp;
+    int8_t rssi;
+    uint8_t lqi;
+    uint8_t channel;
+    uint8_t length;             /* PSDU length, without the FCS */
+    bool transmitted;
+    uint8_t psdu[EZB_RADIO_FRAME_MAX_SIZE];
+} capture_slot_t;
+
+typedef struct capture_ctx_s {
+    ezb_mac_capture_config_t config;
+    ezb_mac_capture_stats_t stats;
+    capture_slot_t *slots;
+    atomic_uint_fast32_t head;  /* Written by the producer, the Zigbee task */
+    atomic_uint_fast32_t tail;  /* Written by the consumer, the capture task */
+    atomic_bool running;
+    bool promiscuous;           /* The promiscuous mode before the capture */
+    TaskHandle_t task;
+    SemaphoreHandle_t done;
+    ezb_mac_radio_hook_t hook;
+    uint8_t buffer[PCAPNG_EPB_MAX_SIZE];
+} capture_ctx_t;
+
+static capture_ctx_t *s_capture;
+
+static inline uint8_t *put_u16(uint8_t *p, uint16_t value)
+{
+    memcpy(p, &value, sizeof(value));
+    return p + sizeof(value);
+}
+
+static inline uint8_t *put_u32(uint8_t *p, uint32_t value)
+{
+    memcpy(p, &value, sizeof(value));
+    return p + sizeof(value);
+}
+
+static uint8_t *put_tlv(uint8_t *p, uint16_t type, const void *value, uint16_t length)
+{
+    p = put_u16(p, type);
+    p = put_u16(p, length);
+    memset(p, 0, PAD4(length));
+    memcpy(p, value, length);
+    return p + PAD4(length);
+}
+
+static void capture_push(const ezb_radio_frame_t *frame, bool transmitted)
+{
+    uint32_t head = atomic_load_explicit(&s_capture->head, memory_order_relaxed);
+    uint32_t tail = atomic_load_explicit(&s_capture->tail, memory_order_acquire);
+    capture_slot_t *slot;
+
+    if (head - tail >= s_capture->config.ring_size) {
+        s_capture->stats.dropped++;
+        return;
+    }
+    slot = &s_capture->slots[head & (s_capture->config.ring_size - 1)];
+    slot->transmitted = transmitted;
+    slot->channel = frame->channel;
+    slot->length = frame->length > EZB_MAC_FCS_SIZE ? frame->length - EZB_MAC_FCS_SIZE : 0;
+    memcpy(slot->psdu, frame->psdu, slot->length);
+    if (transmitted) {
+        slot->timestamp = frame->info.tx.timestamp ? frame->info.tx.timestamp : (uint64_t)esp_timer_get_time();
+        slot->rssi = EZB_RADIO_RSSI_INVALID;
+        slot->lqi = EZB_RADIO_LQI_NONE;
+    } else {
+        slot->timestamp = frame->info.rx.timestamp;
+        slot->rssi = frame->info.rx.rssi;
+        slot->lqi = frame->info.rx.lqi;
+    }
+    atomic_store_explicit(&s_capture->head, head + 1, memory_order_release);
+    s_capture->stats.captured++;
+    xTaskNotifyGive(s_capture->task);
+}
+
+static void capture_radio_rx(const ezb_radio_frame_t *frame)
+{
+    capture_push(frame, false);
+}
+
+static void capture_radio_tx_done(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr,
+                                  const ezb_radio_frame_t *ack, ezb_err_t error)
+{
+    /* Nothing is sent on a channel access failure. */
+    if (error == EZB_ERR_NONE || error == EZB_ERR_MAC_NO_ACK) {
+        capture_push(frame, true);
+    }
+}
+
+static bool capture_write_headers(void)
+{
+    uint8_t *p = s_capture->buffer;
+
+    p = put_u32(p, PCAPNG_BLOCK_SHB);
+    p = put_u32(p, PCAPNG_SHB_SIZE);
+    p = put_u32(p, PCAPNG_BYTE_ORDER);
+    p = put_u16(p, 1);                  /* Major version */
+    p = put_u16(p, 0);                  /* Minor version */
+    p = put_u32(p, UINT32_MAX);         /* Section length unknown, -1 as 64 bits */
+    p = put_u32(p, UINT32_MAX);
+    p = put_u32(p, PCAPNG_SHB_SIZE);
+
+    p = put_u32(p, PCAPNG_BLOCK_IDB);
+    p = put_u32(p, PCAPNG_IDB_SIZE);
+    p = put_u16(p, PCAPNG_LINKTYPE_TAP);
+    p = put_u16(p, 0);
+    p = put_u32(p, 0);                  /* No snap length, the timestamps are in microseconds by default */
+    p = put_u32(p, PCAPNG_IDB_SIZE);
+
+    return s_capture->config.write(s_capture->buffer, p - s_capture->buffer, s_capture->config.ctx);
+}
+
+static size_t capture_format(const capture_slot_t *slot)
+{
+    uint8_t *tap = s_capture->buffer + PCAPNG_EPB_HEADER_SIZE;
+    uint8_t *p = tap + 4;
+    uint8_t fcs_type = TAP_FCS_TYPE_NONE;
+    uint8_t channel[3] = {slot->channel, 0, 0};     /* Channel (16 bits) and channel page */
+    uint32_t block_size;
+    uint32_t packet_size;
+
+    p = put_tlv(p, TAP_TLV_FCS_TYPE, &fcs_type, sizeof(fcs_type));
+    p = put_tlv(p, TAP_TLV_CHANNEL, channel, sizeof(channel));
+    if (!slot->transmitted) {
+        float rss = slot->rssi;
+        p = put_tlv(p, TAP_TLV_RSS, &rss, sizeof(rss));
+        p = put_tlv(p, TAP_TLV_LQI, &slot->lqi, sizeof(slot->lqi));
+    }
+    tap[0] = 0;                         /* Version */
+    tap[1] = 0;
+    put_u16(tap + 2, p - tap);
+    memcpy(p, slot->psdu, slot->length);
+    packet_size = (p - tap) + slot->length;
+    memset(p + slot->length, 0, PAD4(packet_size) - packet_size);
+    block_size = PCAPNG_EPB_HEADER_SIZE + PAD4(packet_size) + 4;
+
+    p = s_capture->buffer;
+    p = put_u32(p, PCAPNG_BLOCK_EPB);
+    p = put_u32(p, block_size);
+    p = put_u32(p, 0);                  /* Interface */
+    p = put_u32(p, slot->timestamp >> 32);
+    p = put_u32(p, slot->timestamp & UINT32_MAX);
+    p = put_u32(p, packet_size);
+    p = put_u32(p, packet_size);
+    put_u32(s_capture->buffer + block_size - 4, block_size);
+    return block_size;
+}
+
+static void capture_drain(void)
+{
+    uint32_t tail = atomic_load_explicit(&s_capture->tail, memory_order_relaxed);
+
+    while (tail != atomic_load_explicit(&s_capture->head, memory_order_acquire)) {
+        size_t size = capture_format(&s_capture->slots[tail & (s_capture->config.ring_size - 1)]);
+        /* Release the slot before the output, which may block. */
+        atomic_store_explicit(&s_capture->tail, ++tail, memory_order_release);
+        if (s_capture->config.write(s_capture->buffer, size, s_capture->config.ctx)) {
+            s_capture->stats.written++;
+        } else {
+            s_capture->stats.write_errors++;
+        }
+    }
+}
+
+static void capture_task(void *arg)
+{
+    if (!capture_write_headers()) {
+        s_capture->stats.write_errors++;
+    }
+    while (atomic_load(&s_capture->running)) {
+        capture_drain();
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(CAPTURE_IDLE_MS));
+    }
+    capture_drain();
+    xSemaphoreGive(s_capture->done);
+    vTaskDelete(NULL);
+}
+
+ezb_err_t ezb_mac_capture_start(const ezb_mac_capture_config_t *config)
+{
+    if (!config || !config->write || !config->ring_size || (config->ring_size & (config->ring_size - 1))) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_capture) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_capture = calloc(1, sizeof(capture_ctx_t));
+    if (!s_capture) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_capture->config = *config;
+    atomic_init(&s_capture->head, 0);
+    atomic_init(&s_capture->tail, 0);
+    atomic_init(&s_capture->running, true);
+    s_capture->slots = calloc(config->ring_size, sizeof(capture_slot_t));
+    s_capture->done = xSemaphoreCreateBinary();
+    if (!s_capture->slots || !s_capture->done ||
+        xTaskCreate(capture_task, "zb_capture", config->task_stack_size, NULL, config->task_priority,
+                    &s_capture->task) != pdPASS) {
+        if (s_capture->done) {
+            vSemaphoreDelete(s_capture->done);
+        }
+        free(s_capture->slots);
+        free(s_capture);
+        s_capture = NULL;
+        return EZB_ERR_NO_MEM;
+    }
+
+    s_capture->promiscuous = ezb_plat_radio_get_promiscuous();
+    if (config->promiscuous) {
+        ezb_plat_radio_set_promiscuous(true);
+    }
+    s_capture->hook.capture = capture_radio_rx;
+    s_capture->hook.tx_done = config->transmitted ? capture_radio_tx_done : NULL;
+    ezb_mac_radio_hook_register(&s_capture->hook);
+    return EZB_ERR_NONE;
+}
+
+void ezb_mac_capture_stop(void)
+{
+    if (!s_capture) {
+        return;
+    }
+    ezb_mac_radio_hook_unregister(&s_capture->hook);
+    if (s_capture->config.promiscuous) {
+        ezb_plat_radio_set_promiscuous(s_capture->promiscuous);
+    }
+    atomic_store(&s_capture->running, false);
+    xTaskNotifyGive(s_capture->task);
+    xSemaphoreTake(s_capture->done, portMAX_DELAY);
+    vSemaphoreDelete(s_capture->done);
+    free(s_capture->slots);
+    free(s_capture);
+    s_capture = NULL;
+}
+
+void ezb_mac_capture_get_stats(ezb_mac_capture_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_capture) {
+        memset(stats, 0, sizeof(ezb_mac_capture_stats_t));
+        return;
+    }
+    *stats = s_capture->stats;
+}
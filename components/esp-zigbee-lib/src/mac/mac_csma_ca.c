@@ -0,0 +1,236 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/mac/mac_csma_ca.h>
+
+#include "mac/mac_radio_hook.h"
+
+/* IEEE 802.15.4-2015, 8.4.2 MAC PIB attributes */
+#define CSMA_BE_MAX       8U
+#define CSMA_BACKOFFS_MAX 5U
+
+#define CSMA_CHANNEL_NUM      (EZB_RADIO_2P4GHZ_CHANNEL_MAX - EZB_RADIO_2P4GHZ_CHANNEL_MIN + 1)
+#define CSMA_PERMILLE(n, d)   ((d) ? (uint32_t)(n) * 1000U / (d) : 0U)
+
+typedef struct csma_entry_s {
+    ezb_mac_csma_ca_controller_stats_t stats;
+    uint16_t window_frames;
+    uint16_t window_acked;          /* Transmissions that requested an acknowledgement */
+    uint16_t window_failures;
+    uint16_t window_no_acks;
+} csma_entry_t;
+
+typedef struct csma_ctx_s {
+    ezb_mac_csma_ca_controller_config_t config;
+    ezb_mac_csma_ca_params_t base;
+    csma_entry_t entries[CSMA_CHANNEL_NUM][EZB_MAC_CSMA_CA_CLASS_MAX_NR];
+    ezb_mac_radio_hook_t hook;
+} csma_ctx_t;
+
+static csma_ctx_t *s_csma;
+
+extern ezb_err_t __real_ezb_mac_set_csma_ca_params(const ezb_mac_csma_ca_params_t *params);
+
+/* Restart every channel and class from the parameters of the stack. */
+static void csma_rebase(const ezb_mac_csma_ca_params_t *base)
+{
+    s_csma->base = *base;
+    for (uint8_t i = 0; i < CSMA_CHANNEL_NUM; i++) {
+        for (uint8_t cls = 0; cls < EZB_MAC_CSMA_CA_CLASS_MAX_NR; cls++) {
+            csma_entry_t *entry = &s_csma->entries[i][cls];
+            entry->stats.params = *base;
+            entry->window_frames = 0;
+            entry->window_acked = 0;
+            entry->window_failures = 0;
+            entry->window_no_acks = 0;
+        }
+    }
+}
+
+static csma_entry_t *csma_entry(uint8_t channel, const ezb_mac_frame_t *mhr)
+{
+    ezb_mac_csma_ca_class_t cls = EZB_MAC_CSMA_CA_CLASS_UNICAST;
+
+    if (channel < EZB_RADIO_2P4GHZ_CHANNEL_MIN || channel > EZB_RADIO_2P4GHZ_CHANNEL_MAX) {
+        return NULL;
+    }
+    if (mhr->type == EZB_MAC_FRAME_TYPE_COMMAND) {
+        cls = EZB_MAC_CSMA_CA_CLASS_COMMAND;
+    } else if (!mhr->ack_request) {
+        cls = EZB_MAC_CSMA_CA_CLASS_BROADCAST;
+    }
+    return &s_csma->entries[channel - EZB_RADIO_2P4GHZ_CHANNEL_MIN][cls];
+}
+
+static bool csma_increase_backoffs(ezb_mac_csma_ca_params_t *params)
+{
+    if (params->max_backoffs < CSMA_BACKOFFS_MAX) {
+        params->max_backoffs++;
+    } else if (params->max_be < CSMA_BE_MAX) {
+        params->max_be++;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static bool csma_increase_min_be(ezb_mac_csma_ca_params_t *params)
+{
+    if (params->min_be < params->max_be) {
+        params->min_be++;
+    } else if (params->max_be < CSMA_BE_MAX) {
+        params->min_be++;
+        params->max_be++;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+/* Undo the increases in the reverse order, never below the parameters of the stack. */
+static bool csma_decrease(ezb_mac_csma_ca_params_t *params)
+{
+    const ezb_mac_csma_ca_params_t *base = &s_csma->base;
+
+    if (params->min_be > base->min_be) {
+        params->min_be--;
+    } else if (params->max_be > base->max_be) {
+        params->max_be--;
+    } else if (params->max_backoffs > base->max_backoffs) {
+        params->max_backoffs--;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+static void csma_adjust(csma_entry_t *entry)
+{
+    const ezb_mac_csma_ca_controller_config_t *config = &s_csma->config;
+    uint32_t busy = CSMA_PERMILLE(entry->window_failures, entry->window_frames);
+    uint32_t collision = CSMA_PERMILLE(entry->window_no_acks, entry->window_acked);
+
+    if (busy > config->busy_high) {
+        entry->stats.increases += csma_increase_backoffs(&entry->stats.params);
+    } else if (collision > config->collision_high) {
+        entry->stats.increases += csma_increase_min_be(&entry->stats.params);
+    } else if (busy < config->busy_low && collision < config->collision_low) {
+        entry->stats.decreases += csma_decrease(&entry->stats.params);
+    }
+
+    entry->window_frames = 0;
+    entry->window_acked = 0;
+    entry->window_failures = 0;
+    entry->window_no_acks = 0;
+}
+
+static void csma_radio_tx_prepare(ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr)
+{
+    csma_entry_t *entry = csma_entry(frame->channel, mhr);
+
+    if (entry) {
+        frame->info.tx.min_csma_be = entry->stats.params.min_be;
+        frame->info.tx.max_csma_be = entry->stats.params.max_be;
+        frame->info.tx.max_csma_backoffs = entry->stats.params.max_backoffs;
+    }
+}
+
+static void csma_radio_tx_done(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr,
+                               const ezb_radio_frame_t *ack, ezb_err_t error)
+{
+    csma_entry_t *entry = csma_entry(frame->channel, mhr);
+
+    if (!entry || (error != EZB_ERR_NONE && error != EZB_ERR_MAC_NO_ACK &&
+                   error != EZB_ERR_MAC_CHANNEL_ACCESS_FAILURE)) {
+        return;
+    }
+
+    entry->stats.frames++;
+    entry->window_frames++;
+    if (error == EZB_ERR_MAC_CHANNEL_ACCESS_FAILURE) {
+        entry->stats.access_failures++;
+        entry->window_failures++;
+    } else if (mhr->ack_request) {
+        entry->window_acked++;
+        if (error == EZB_ERR_MAC_NO_ACK) {
+            entry->stats.no_acks++;
+            entry->window_no_acks++;
+        }
+    }
+    if (entry->window_frames >= s_csma->config.window) {
+        csma_adjust(entry);
+    }
+}
+
+ezb_err_t ezb_mac_csma_ca_controller_init(const ezb_mac_csma_ca_controller_config_t *config)
+{
+    ezb_mac_csma_ca_params_t base;
+    ezb_err_t ret;
+
+    if (!config || !config->window || config->busy_low > config->busy_high ||
+        config->collision_low > config->collision_high) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_csma) {
+        return EZB_ERR_INV_STATE;
+    }
+    /* The getter is marked experimental, it is read once here and the setter is wrapped to follow the changes. */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wattribute-warning"
+    ret = ezb_mac_get_csma_ca_params(&base);
+#pragma GCC diagnostic pop
+    if (ret != EZB_ERR_NONE) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_csma = calloc(1, sizeof(csma_ctx_t));
+    if (!s_csma) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_csma->config = *config;
+    csma_rebase(&base);
+    s_csma->hook.tx_prepare = csma_radio_tx_prepare;
+    s_csma->hook.tx_done = csma_radio_tx_done;
+    ezb_mac_radio_hook_register(&s_csma->hook);
+    return EZB_ERR_NONE;
+}
+
+void ezb_mac_csma_ca_controller_deinit(void)
+{
+    if (!s_csma) {
+        return;
+    }
+    ezb_mac_radio_hook_unregister(&s_csma->hook);
+    free(s_csma);
+    s_csma = NULL;
+}
+
+ezb_err_t ezb_mac_csma_ca_controller_get_stats(uint8_t channel, ezb_mac_csma_ca_class_t cls,
+                                               ezb_mac_csma_ca_controller_stats_t *stats)
+{
+    if (!stats || channel < EZB_RADIO_2P4GHZ_CHANNEL_MIN || channel > EZB_RADIO_2P4GHZ_CHANNEL_MAX ||
+        cls >= EZB_MAC_CSMA_CA_CLASS_MAX_NR) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_csma) {
+        return EZB_ERR_INV_STATE;
+    }
+    *stats = s_csma->entries[channel - EZB_RADIO_2P4GHZ_CHANNEL_MIN][cls].stats;
+    return EZB_ERR_NONE;
+}
+
+ezb_err_t __wrap_ezb_mac_set_csma_ca_params(const ezb_mac_csma_ca_params_t *params)
+{
+    ezb_err_t ret = __real_ezb_mac_set_csma_ca_params(params);
+
+    if (ret == EZB_ERR_NONE && s_csma) {
+        csma_rebase(params);
+    }
+    return ret;
+}
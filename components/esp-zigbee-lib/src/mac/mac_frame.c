@@ -0,0 +1,245 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include "mac/mac_frame.h"
+
+/* IEEE 802.15.4-2015, 7.2.2 Frame Control field */
+#define MAC_FCF_TYPE_MASK         0x0007U
+#define MAC_FCF_SECURITY          (1U << 3)
+#define MAC_FCF_FRAME_PENDING     (1U << 4)
+#define MAC_FCF_ACK_REQUEST       (1U << 5)
+#define MAC_FCF_PANID_COMPRESSION (1U << 6)
+#define MAC_FCF_SEQ_SUPPRESSION   (1U << 8)
+#define MAC_FCF_IE_PRESENT        (1U << 9)
+#define MAC_FCF_DST_MODE_SHIFT    10
+#define MAC_FCF_VERSION_SHIFT     12
+#define MAC_FCF_SRC_MODE_SHIFT    14
+#define MAC_FRAME_VERSION_2015    2U
+
+/* IEEE 802.15.4-2015, 9.4.1 Auxiliary Security Header */
+#define MAC_SEC_KEY_ID_MODE_SHIFT 3
+#define MAC_SEC_FC_SUPPRESSION    (1U << 5)
+
+/* Zigbee specification 3.3.1.1 Frame Control Field */
+#define NWK_FCF_TYPE_MASK         0x0003U
+#define NWK_FCF_MULTICAST         (1U << 8)
+#define NWK_FCF_SECURITY          (1U << 9)
+#define NWK_FCF_SOURCE_ROUTE      (1U << 10)
+#define NWK_FCF_DST_IEEE          (1U << 11)
+#define NWK_FCF_SRC_IEEE          (1U << 12)
+#define NWK_HEADER_MIN_SIZE       8U
+
+/* Zigbee specification 4.5.1 Auxiliary Frame Header Format */
+#define NWK_SEC_KEY_ID_SHIFT      3
+#define NWK_SEC_KEY_ID_MASK       0x03U
+#define NWK_SEC_KEY_ID_NETWORK    1U
+#define NWK_SEC_EXTENDED_NONCE    (1U << 5)
+
+static inline uint16_t get_le16(const uint8_t *p)
+{
+    return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+static inline uint32_t get_le32(const uint8_t *p)
+{
+    return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static bool mac_read_addr(const uint8_t **pos, const uint8_t *end, uint8_t mode, ezb_address_t *addr)
+{
+    switch (mode) {
+    case EZB_ADDR_MODE_NONE:
+        addr->addr_mode = EZB_ADDR_MODE_NONE;
+        return true;
+    case EZB_ADDR_MODE_SHORT:
+        if (end - *pos < 2) {
+            return false;
+        }
+        ezb_address_set_short(addr, get_le16(*pos));
+        *pos += 2;
+        return true;
+    case EZB_ADDR_MODE_EXT:
+        if (end - *pos < 8) {
+            return false;
+        }
+        addr->addr_mode = EZB_ADDR_MODE_EXT;
+        memcpy(addr->u.extended_addr.u8, *pos, 8);
+        *pos += 8;
+        return true;
+    default:
+        return false;
+    }
+}
+
+static uint8_t mac_security_header_size(uint8_t sec_ctrl)
+{
+    static const uint8_t key_id_size[] = {0, 1, 5, 9};
+    uint8_t size = 1 + key_id_size[(sec_ctrl >> MAC_SEC_KEY_ID_MODE_SHIFT) & 0x03U];
+
+    if (!(sec_ctrl & MAC_SEC_FC_SUPPRESSION)) {
+        size += 4;
+    }
+    return size;
+}
+
+bool ezb_mac_frame_parse(const uint8_t *psdu, uint8_t length, ezb_mac_frame_t *frame)
+{
+    const uint8_t *pos = psdu;
+    const uint8_t *end;
+    uint16_t fcf;
+    uint8_t dst_mode, src_mode, version;
+    bool panid_compression;
+
+    if (!psdu || length < 2 + EZB_MAC_FCS_SIZE) {
+        return false;
+    }
+    end = psdu + length - EZB_MAC_FCS_SIZE;
+    fcf = get_le16(pos);
+    pos += 2;
+
+    version = (fcf >> MAC_FCF_VERSION_SHIFT) & 0x03U;
+    dst_mode = (fcf >> MAC_FCF_DST_MODE_SHIFT) & 0x03U;
+    src_mode = (fcf >> MAC_FCF_SRC_MODE_SHIFT) & 0x03U;
+    panid_compression = fcf & MAC_FCF_PANID_COMPRESSION;
+    if (fcf & MAC_FCF_IE_PRESENT) {
+        return false;
+    }
+
+    memset(frame, 0, sizeof(ezb_mac_frame_t));
+    frame->type = fcf & MAC_FCF_TYPE_MASK;
+    frame->security = fcf & MAC_FCF_SECURITY;
+    frame->frame_pending = fcf & MAC_FCF_FRAME_PENDING;
+    frame->ack_request = fcf & MAC_FCF_ACK_REQUEST;
+
+    if (!(version == MAC_FRAME_VERSION_2015 && (fcf & MAC_FCF_SEQ_SUPPRESSION))) {
+        if (pos >= end) {
+            return false;
+        }
+        frame->seq = *pos++;
+    }
+
+    if (dst_mode != EZB_ADDR_MODE_NONE) {
+        if (end - pos < 2) {
+            return false;
+        }
+        frame->dst_panid = get_le16(pos);
+        pos += 2;
+    }
+    if (!mac_read_addr(&pos, end, dst_mode, &frame->dst)) {
+        return false;
+    }
+    /* The source PAN ID is elided when compressed, or when there is no destination in the 2015 frame format. */
+    if (src_mode != EZB_ADDR_MODE_NONE && !panid_compression &&
+        !(version == MAC_FRAME_VERSION_2015 && dst_mode == EZB_ADDR_MODE_NONE)) {
+        if (end - pos < 2) {
+            return false;
+        }
+        pos += 2;
+    }
+    if (!mac_read_addr(&pos, end, src_mode, &frame->src)) {
+        return false;
+    }
+
+    if (frame->security) {
+        uint8_t size;
+        if (pos >= end) {
+            return false;
+        }
+        size = mac_security_header_size(*pos);
+        if (end - pos < size) {
+            return false;
+        }
+        pos += size;
+    }
+
+    frame->payload = pos;
+    frame->payload_len = end - pos;
+    return true;
+}
+
+bool ezb_nwk_frame_parse(const ezb_mac_frame_t *mac, ezb_nwk_frame_t *frame)
+{
+    const uint8_t *pos = mac->payload;
+    uint16_t fcf;
+
+    if (mac->type != EZB_MAC_FRAME_TYPE_DATA || mac->payload_len < NWK_HEADER_MIN_SIZE) {
+        return false;
+    }
+
+    fcf = get_le16(pos);
+    frame->type = fcf & NWK_FCF_TYPE_MASK;
+    frame->security = fcf & NWK_FCF_SECURITY;
+    frame->source_route = fcf & NWK_FCF_SOURCE_ROUTE;
+    frame->dst = get_le16(pos + 2);
+    frame->src = get_le16(pos + 4);
+    frame->radius = pos[6];
+    frame->seq = pos[7];
+    return frame->type != EZB_NWK_FRAME_TYPE_INTERPAN;
+}
+
+bool ezb_nwk_security_parse(const ezb_mac_frame_t *mac, ezb_nwk_security_t *sec)
+{
+    const uint8_t *pos = mac->payload;
+    const uint8_t *end = mac->payload + mac->payload_len;
+    const uint8_t *src_ieee = NULL;
+    uint16_t fcf;
+
+    if (mac->type != EZB_MAC_FRAME_TYPE_DATA || mac->payload_len < NWK_HEADER_MIN_SIZE) {
+        return false;
+    }
+    fcf = get_le16(pos);
+    if (!(fcf & NWK_FCF_SECURITY) || (fcf & NWK_FCF_TYPE_MASK) == EZB_NWK_FRAME_TYPE_INTERPAN) {
+        return false;
+    }
+    pos += NWK_HEADER_MIN_SIZE;
+    if (fcf & NWK_FCF_DST_IEEE) {
+        pos += 8;
+    }
+    if (fcf & NWK_FCF_SRC_IEEE) {
+        src_ieee = pos;
+        pos += 8;
+    }
+    if (fcf & NWK_FCF_MULTICAST) {
+        pos += 1;
+    }
+    if (fcf & NWK_FCF_SOURCE_ROUTE) {
+        if (end - pos < 2) {
+            return false;
+        }
+        pos += 2 + 2 * pos[0];
+    }
+    /* Security control and frame counter */
+    if (end - pos < 5) {
+        return false;
+    }
+    sec->control_offset = pos - mac->payload;
+    sec->control = pos[0];
+    sec->frame_counter = get_le32(pos + 1);
+    pos += 5;
+    if (((sec->control >> NWK_SEC_KEY_ID_SHIFT) & NWK_SEC_KEY_ID_MASK) != NWK_SEC_KEY_ID_NETWORK) {
+        return false;
+    }
+    if (sec->control & NWK_SEC_EXTENDED_NONCE) {
+        if (end - pos < 8) {
+            return false;
+        }
+        src_ieee = pos;
+        pos += 8;
+    }
+    if (!src_ieee || end - pos < 1) {
+        return false;
+    }
+    memcpy(sec->source.u8, src_ieee, 8);
+    sec->key_seq = *pos++;
+
+    sec->header = mac->payload;
+    sec->header_len = pos - mac->payload;
+    sec->payload = pos;
+    sec->payload_len = end - pos;
+    return true;
+}
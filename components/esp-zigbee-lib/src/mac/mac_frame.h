@@ -0,0 +1,89 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <ezbee/core_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EZB_MAC_FRAME_TYPE_BEACON  0x00U
+#define EZB_MAC_FRAME_TYPE_DATA    0x01U
+#define EZB_MAC_FRAME_TYPE_ACK     0x02U
+#define EZB_MAC_FRAME_TYPE_COMMAND 0x03U
+
+#define EZB_MAC_CMD_DATA_REQUEST 0x04U
+
+#define EZB_MAC_FCS_SIZE 2U
+
+#define EZB_NWK_FRAME_TYPE_DATA     0x00U
+#define EZB_NWK_FRAME_TYPE_COMMAND  0x01U
+#define EZB_NWK_FRAME_TYPE_INTERPAN 0x03U
+
+/* Broadcast addresses are 0xFFF8 to 0xFFFF, see Zigbee specification 3.6.5 */
+#define EZB_NWK_IS_BROADCAST_ADDR(addr) ((addr) >= 0xFFF8U)
+
+/**
+ * @brief The decoded MAC header of an IEEE 802.15.4 frame.
+ */
+typedef struct ezb_mac_frame_s {
+    uint8_t type;               /* EZB_MAC_FRAME_TYPE_* */
+    uint8_t seq;
+    bool security;
+    bool frame_pending;
+    bool ack_request;
+    ezb_panid_t dst_panid;
+    ezb_address_t dst;          /* EZB_ADDR_MODE_NONE, EZB_ADDR_MODE_SHORT or EZB_ADDR_MODE_EXT */
+    ezb_address_t src;
+    const uint8_t *payload;     /* MAC payload, the FCS is not included */
+    uint8_t payload_len;
+} ezb_mac_frame_t;
+
+/**
+ * @brief The decoded fixed part of a Zigbee NWK header.
+ */
+typedef struct ezb_nwk_frame_s {
+    uint8_t type;               /* EZB_NWK_FRAME_TYPE_* */
+    bool security;
+    bool source_route;
+    ezb_shortaddr_t dst;
+    ezb_shortaddr_t src;
+    uint8_t radius;
+    uint8_t seq;
+} ezb_nwk_frame_t;
+
+/**
+ * @brief The decoded NWK auxiliary security header of a secured Zigbee NWK frame.
+ */
+typedef struct ezb_nwk_security_s {
+    uint8_t control;            /* Security control field, as sent with the security level set to zero */
+    uint32_t frame_counter;
+    ezb_extaddr_t source;       /* Extended address of the device that secured the frame */
+    uint8_t key_seq;            /* Sequence number of the network key */
+    const uint8_t *header;      /* NWK header followed by the auxiliary header, the authenticated data */
+    uint8_t header_len;
+    uint8_t control_offset;     /* Offset of the security control field in the header */
+    const uint8_t *payload;     /* Encrypted payload followed by the MIC */
+    uint8_t payload_len;
+} ezb_nwk_security_t;
+
+/* Decode the MAC header of a PSDU, return false if the frame is malformed or uses header IEs. */
+bool ezb_mac_frame_parse(const uint8_t *psdu, uint8_t length, ezb_mac_frame_t *frame);
+
+/* Decode the NWK header carried by a MAC data frame, return false if there is none. */
+bool ezb_nwk_frame_parse(const ezb_mac_frame_t *mac, ezb_nwk_frame_t *frame);
+
+/* Decode the auxiliary security header of a NWK frame secured with the network key, return false if there is none. */
+bool ezb_nwk_security_parse(const ezb_mac_frame_t *mac, ezb_nwk_security_t *sec);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
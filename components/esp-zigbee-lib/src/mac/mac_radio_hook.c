@@ -0,0 +1,156 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+
+#include "esp_zigbee.h"
+
+#include "mac/mac_radio_hook.h"
+
+#define RADIO_BROADCAST_PANID 0xFFFFU
+
+/* The radio platform functions below are wrapped with the linker option "--wrap", see CMakeLists.txt. */
+extern ezb_err_t __real_ezb_plat_radio_transmit(ezb_radio_frame_t *frame);
+extern void __real_ezb_plat_radio_transmit_done(ezb_radio_frame_t *frame, ezb_radio_frame_t *ack, ezb_err_t error);
+extern void __real_ezb_plat_radio_receive_done(ezb_radio_frame_t *frame, ezb_err_t error);
+
+static ezb_mac_radio_hook_t *s_hooks;
+static bool s_nwk_secured_sent;
+
+void ezb_mac_radio_hook_register(ezb_mac_radio_hook_t *hook)
+{
+    for (ezb_mac_radio_hook_t *iter = s_hooks; iter; iter = iter->next) {
+        if (iter == hook) {
+            return;
+        }
+    }
+    hook->next = s_hooks;
+    s_hooks = hook;
+}
+
+void ezb_mac_radio_hook_unregister(ezb_mac_radio_hook_t *hook)
+{
+    for (ezb_mac_radio_hook_t **link = &s_hooks; *link; link = &(*link)->next) {
+        if (*link == hook) {
+            *link = hook->next;
+            hook->next = NULL;
+            return;
+        }
+    }
+}
+
+/* Complete a dropped frame the way the radio would, outside of the transmit call. */
+static void radio_transmit_dropped(void *ctx)
+{
+    ezb_radio_frame_t *frame = (ezb_radio_frame_t *)ctx;
+
+    ezb_plat_radio_transmit_started(frame);
+    __real_ezb_plat_radio_transmit_done(frame, NULL, EZB_ERR_NONE);
+}
+
+bool ezb_mac_radio_nwk_secured_sent(void)
+{
+    return s_nwk_secured_sent;
+}
+
+/* Only parsed until the first secured NWK frame, the flag is never cleared. */
+static void radio_track_nwk_secured(const ezb_mac_frame_t *mhr)
+{
+    ezb_nwk_frame_t nwk;
+
+    if (ezb_nwk_frame_parse(mhr, &nwk) && nwk.security) {
+        s_nwk_secured_sent = true;
+    }
+}
+
+ezb_err_t __wrap_ezb_plat_radio_transmit(ezb_radio_frame_t *frame)
+{
+    ezb_mac_frame_t mhr;
+    bool drop = false;
+
+    if ((s_hooks || !s_nwk_secured_sent) && ezb_mac_frame_parse(frame->psdu, frame->length, &mhr)) {
+        if (!s_nwk_secured_sent) {
+            radio_track_nwk_secured(&mhr);
+        }
+        for (ezb_mac_radio_hook_t *hook = s_hooks; hook; hook = hook->next) {
+            if (hook->tx_prepare) {
+                hook->tx_prepare(frame, &mhr);
+            }
+        }
+        for (ezb_mac_radio_hook_t *hook = s_hooks; hook && !drop; hook = hook->next) {
+            drop = hook->tx && !hook->tx(frame, &mhr);
+        }
+    }
+    if (drop && esp_zigbee_task_queue_post(radio_transmit_dropped, frame) == ESP_OK) {
+        return EZB_ERR_NONE;
+    }
+    return __real_ezb_plat_radio_transmit(frame);
+}
+
+void __wrap_ezb_plat_radio_transmit_done(ezb_radio_frame_t *frame, ezb_radio_frame_t *ack, ezb_err_t error)
+{
+    ezb_mac_frame_t mhr;
+
+    if (s_hooks && frame && ezb_mac_frame_parse(frame->psdu, frame->length, &mhr)) {
+        for (ezb_mac_radio_hook_t *hook = s_hooks; hook; hook = hook->next) {
+            if (hook->tx_done) {
+                hook->tx_done(frame, &mhr, ack, error);
+            }
+        }
+    }
+    __real_ezb_plat_radio_transmit_done(frame, ack, error);
+}
+
+/* In promiscuous mode, the radio also passes up the frames exchanged between other devices. */
+static bool radio_frame_is_addressed(const ezb_mac_frame_t *mhr)
+{
+    ezb_extaddr_t extaddr;
+
+    switch (mhr->dst.addr_mode) {
+    case EZB_ADDR_MODE_NONE:
+        /* Beacons, the acknowledgements of this device complete its transmissions instead. */
+        return mhr->type != EZB_MAC_FRAME_TYPE_ACK;
+    case EZB_ADDR_MODE_SHORT:
+        if (mhr->dst_panid != RADIO_BROADCAST_PANID && mhr->dst_panid != ezb_nwk_get_panid()) {
+            return false;
+        }
+        return mhr->dst.u.short_addr == EZB_RADIO_BROADCAST_SHORT_ADDR ||
+               mhr->dst.u.short_addr == ezb_nwk_get_short_address();
+    case EZB_ADDR_MODE_EXT:
+        /* Not checked against the PAN, the association response arrives before the PAN is set. */
+        ezb_nwk_get_extended_address(&extaddr);
+        return mhr->dst.u.extended_addr.u64 == extaddr.u64;
+    default:
+        return false;
+    }
+}
+
+void __wrap_ezb_plat_radio_receive_done(ezb_radio_frame_t *frame, ezb_err_t error)
+{
+    ezb_mac_frame_t mhr;
+
+    if (s_hooks && frame && error == EZB_ERR_NONE) {
+        for (ezb_mac_radio_hook_t *hook = s_hooks; hook; hook = hook->next) {
+            if (hook->capture) {
+                hook->capture(frame);
+            }
+        }
+        if (ezb_mac_frame_parse(frame->psdu, frame->length, &mhr) &&
+            (!ezb_plat_radio_get_promiscuous() || radio_frame_is_addressed(&mhr))) {
+            for (ezb_mac_radio_hook_t *hook = s_hooks; hook; hook = hook->next) {
+                if (hook->rx_filter && !hook->rx_filter(frame, &mhr)) {
+                    return;
+                }
+            }
+            for (ezb_mac_radio_hook_t *hook = s_hooks; hook; hook = hook->next) {
+                if (hook->rx) {
+                    hook->rx(frame, &mhr);
+                }
+            }
+        }
+    }
+    __real_ezb_plat_radio_receive_done(frame, error);
+}
@@ -0,0 +1,53 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+
+#include <ezbee/platform/radio.h>
+
+#include "mac/mac_frame.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Observer of the frames exchanged between the stack and the radio platform.
+ *
+ * The radio platform functions are wrapped at link time, so the callbacks run in the Zigbee task context on every
+ * frame. They must be short and must not request any transmission. Any callback can be NULL.
+ */
+typedef struct ezb_mac_radio_hook_s {
+    /* A frame has been received without error, before the filters, whether or not it is addressed to this device. */
+    void (*capture)(const ezb_radio_frame_t *frame);
+    /* A frame addressed to this device, or broadcast, has been received without error and passed the filters. */
+    void (*rx)(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr);
+    /* A frame addressed to this device, or broadcast, has been received without error, return false to drop it
+     * before it reaches the stack. */
+    bool (*rx_filter)(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr);
+    /* A frame is about to be transmitted, the transmit information of @p frame may be adjusted. */
+    void (*tx_prepare)(ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr);
+    /* A frame is about to be transmitted, return false to drop it. A dropped frame is reported as sent to the stack. */
+    bool (*tx)(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr);
+    /* The transmission of a frame has completed, @p ack is the received acknowledgement, NULL if there is none. */
+    void (*tx_done)(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr, const ezb_radio_frame_t *ack,
+                    ezb_err_t error);
+    struct ezb_mac_radio_hook_s *next;
+} ezb_mac_radio_hook_t;
+
+/* Register a hook, the hook object must stay valid until it is unregistered. */
+void ezb_mac_radio_hook_register(ezb_mac_radio_hook_t *hook);
+
+void ezb_mac_radio_hook_unregister(ezb_mac_radio_hook_t *hook);
+
+/* Whether a NWK frame secured with the outgoing frame counter has been transmitted since boot. */
+bool ezb_mac_radio_nwk_secured_sent(void);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
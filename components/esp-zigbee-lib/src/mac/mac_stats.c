@@ -0,0 +1,100 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <ezbee/mac/mac_stats.h>
+
+#include "mac/mac_radio_hook.h"
+#include "utils/ezb_stats.h"
+
+/* The last unicast frame whose transmission failed with retries left, a new transmission of it is a retry. */
+static struct {
+    bool valid;
+    uint8_t seq;
+    uint8_t attempts;
+    ezb_address_t dst;
+} s_mac_failed;
+
+static bool mac_stats_is_broadcast(const ezb_mac_frame_t *mhr)
+{
+    return mhr->dst.addr_mode == EZB_ADDR_MODE_SHORT && mhr->dst.u.short_addr == 0xFFFFU;
+}
+
+static void mac_stats_radio_rx(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr)
+{
+    if (mhr->type != EZB_MAC_FRAME_TYPE_DATA && mhr->type != EZB_MAC_FRAME_TYPE_COMMAND) {
+        return;
+    }
+    if (mac_stats_is_broadcast(mhr)) {
+        EZB_STATS_INC(mac.rx_bcast);
+    } else {
+        EZB_STATS_INC(mac.rx_ucast);
+    }
+    g_ezb_stats.mac.last_rssi = frame->info.rx.rssi;
+    g_ezb_stats.mac.last_lqi = frame->info.rx.lqi;
+}
+
+static void mac_stats_radio_tx_done(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr,
+                                    const ezb_radio_frame_t *ack, ezb_err_t error)
+{
+    if (error == EZB_ERR_MAC_CHANNEL_ACCESS_FAILURE) {
+        EZB_STATS_INC(mac.cca_failures);
+    }
+    if (!mhr->ack_request) {
+        if (error == EZB_ERR_NONE && mac_stats_is_broadcast(mhr)) {
+            EZB_STATS_INC(mac.tx_bcast);
+        }
+        return;
+    }
+
+    if (s_mac_failed.valid && s_mac_failed.seq == mhr->seq && ezb_address_compare(&s_mac_failed.dst, &mhr->dst)) {
+        EZB_STATS_INC(mac.tx_ucast_retry);
+        s_mac_failed.attempts++;
+    } else {
+        EZB_STATS_INC(mac.tx_ucast);
+        s_mac_failed.attempts = 1;
+    }
+    if (error == EZB_ERR_MAC_NO_ACK) {
+        EZB_STATS_INC(mac.ack_timeouts);
+    }
+
+    /* A missing acknowledgement is retried by the MAC up to the retries of the frame, any other failure is final. */
+    s_mac_failed.valid = error == EZB_ERR_MAC_NO_ACK && s_mac_failed.attempts <= frame->info.tx.max_frame_retries;
+    if (s_mac_failed.valid) {
+        s_mac_failed.seq = mhr->seq;
+        s_mac_failed.dst = mhr->dst;
+    } else if (error != EZB_ERR_NONE) {
+        EZB_STATS_INC(mac.tx_ucast_fail);
+    }
+}
+
+static ezb_mac_radio_hook_t s_mac_stats_hook = {
+    .rx = mac_stats_radio_rx,
+    .tx_done = mac_stats_radio_tx_done,
+};
+
+void ezb_mac_stats_enable(bool enable)
+{
+    if (enable) {
+        ezb_mac_radio_hook_register(&s_mac_stats_hook);
+    } else {
+        ezb_mac_radio_hook_unregister(&s_mac_stats_hook);
+        s_mac_failed.valid = false;
+    }
+}
+
+void ezb_mac_get_stats(ezb_mac_stats_t *stats)
+{
+    if (stats) {
+        *stats = g_ezb_stats.mac;
+    }
+}
+
+void ezb_mac_reset_stats(void)
+{
+    memset(&g_ezb_stats.mac, 0, sizeof(ezb_mac_stats_t));
+}
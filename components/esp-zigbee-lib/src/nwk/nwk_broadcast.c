@@ -0,0 +1,384 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/platform/alarm.h>
+#include <ezbee/nwk/nwk_broadcast.h>
+
+#include "mac/mac_radio_hook.h"
+#include "nwk/nwk_security.h"
+#include "utils/ezb_hash.h"
+
+#define BTT_MAX_ROUTER_NEIGHBORS 64U
+#define BTT_NEIGHBOR_REFRESH_MS  1000U
+#define BTT_TOKEN_SCALE          1000U
+#define BTT_INDEX_NONE           UINT16_MAX
+/* Number of slots probed from the home slot of an originator. */
+#define BTT_MAX_PROBE            8U
+
+/* Zigbee specification 3.4.1, the route request command */
+#define NWK_CMD_ROUTE_REQUEST    0x01U
+
+typedef struct btt_entry_s {
+    ezb_shortaddr_t src;
+    uint8_t seq;
+    uint8_t tx_count;       /* Number of transmissions of the broadcast by the device */
+    bool dropped;           /* The relay is dropped by the rate limiting, and so are its retransmissions */
+    uint16_t next;          /* The next entry of the same bucket, BTT_INDEX_NONE at the end of the chain */
+    uint16_t nbr_version;   /* Version of the router neighbor list that the heard bits refer to */
+    uint32_t expiry;
+    uint64_t heard;         /* Router neighbors heard relaying the broadcast, indexed as s_btt->routers */
+} btt_entry_t;
+
+typedef struct btt_originator_s {
+    ezb_shortaddr_t addr;
+    uint32_t tokens;        /* In 1/BTT_TOKEN_SCALE of broadcast */
+    uint32_t last_update;
+} btt_originator_t;
+
+typedef struct btt_ctx_s {
+    ezb_nwk_btt_config_t config;
+    /* The entries are allocated in a ring, in the order of their expiry since they all live for entry_timeout. */
+    btt_entry_t *entries;
+    uint16_t head;          /* The oldest entry */
+    uint16_t count;
+    uint16_t *buckets;      /* The first entry of each hash bucket, BTT_INDEX_NONE if empty */
+    btt_originator_t *originators;
+    ezb_shortaddr_t routers[BTT_MAX_ROUTER_NEIGHBORS];
+    uint8_t router_count;
+    bool router_overflow;   /* Too many router neighbors to track, the passive acknowledgement never completes */
+    uint16_t nbr_version;
+    uint32_t nbr_refresh_time;
+    ezb_mac_radio_hook_t hook;
+    ezb_nwk_btt_stats_t stats;
+} btt_ctx_t;
+
+static btt_ctx_t *s_btt;
+
+static inline bool time_reached(uint32_t now, uint32_t time)
+{
+    return (int32_t)(now - time) >= 0;
+}
+
+/* Reduce a hash to a slot with the high bits of the product, the table size is not a power of two. */
+static inline uint16_t btt_slot(uint32_t hash)
+{
+    return (uint16_t)(((uint64_t)hash * s_btt->config.size) >> 32);
+}
+
+static inline uint16_t btt_bucket(ezb_shortaddr_t src, uint8_t seq)
+{
+    return btt_slot(ezb_hash_mix32(((uint32_t)src << 8) | seq));
+}
+
+static void btt_refresh_router_neighbors(uint32_t now)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_neighbor_info_t nbr = {};
+    ezb_shortaddr_t routers[BTT_MAX_ROUTER_NEIGHBORS];
+    uint8_t count = 0;
+    bool overflow = false;
+
+    if (s_btt->nbr_version && !time_reached(now, s_btt->nbr_refresh_time + BTT_NEIGHBOR_REFRESH_MS)) {
+        return;
+    }
+    s_btt->nbr_refresh_time = now;
+
+    while (ezb_nwk_get_next_neighbor(&itor, &nbr) == EZB_ERR_NONE) {
+        if (nbr.device_type != EZB_NWK_DEVICE_TYPE_COORDINATOR && nbr.device_type != EZB_NWK_DEVICE_TYPE_ROUTER) {
+            continue;
+        }
+        if (count == BTT_MAX_ROUTER_NEIGHBORS) {
+            overflow = true;
+            break;
+        }
+        routers[count++] = nbr.short_addr;
+    }
+
+    /* Bump the version only on change, so that entries in flight keep their heard bits. */
+    if (!s_btt->nbr_version || count != s_btt->router_count || overflow != s_btt->router_overflow ||
+        memcmp(routers, s_btt->routers, count * sizeof(ezb_shortaddr_t))) {
+        memcpy(s_btt->routers, routers, count * sizeof(ezb_shortaddr_t));
+        s_btt->router_count = count;
+        s_btt->router_overflow = overflow;
+        if (++s_btt->nbr_version == 0) {
+            s_btt->nbr_version = 1;
+        }
+    }
+}
+
+static void btt_expire(uint32_t now)
+{
+    while (s_btt->count && time_reached(now, s_btt->entries[s_btt->head].expiry)) {
+        btt_entry_t *entry = &s_btt->entries[s_btt->head];
+        uint16_t *link = &s_btt->buckets[btt_bucket(entry->src, entry->seq)];
+
+        while (*link != s_btt->head) {
+            link = &s_btt->entries[*link].next;
+        }
+        *link = entry->next;
+        s_btt->head = (s_btt->head + 1) % s_btt->config.size;
+        s_btt->count--;
+    }
+}
+
+static btt_entry_t *btt_lookup(ezb_shortaddr_t src, uint8_t seq, uint32_t now)
+{
+    uint16_t bucket = btt_bucket(src, seq);
+    uint16_t index;
+
+    btt_expire(now);
+    for (index = s_btt->buckets[bucket]; index != BTT_INDEX_NONE; index = s_btt->entries[index].next) {
+        if (s_btt->entries[index].src == src && s_btt->entries[index].seq == seq) {
+            return &s_btt->entries[index];
+        }
+    }
+
+    if (s_btt->count == s_btt->config.size) {
+        s_btt->stats.table_full++;
+        return NULL;
+    }
+
+    btt_refresh_router_neighbors(now);
+    index = (s_btt->head + s_btt->count) % s_btt->config.size;
+    s_btt->entries[index] = (btt_entry_t){
+        .src = src,
+        .seq = seq,
+        .next = s_btt->buckets[bucket],
+        .nbr_version = s_btt->nbr_version,
+        .expiry = now + s_btt->config.entry_timeout,
+    };
+    s_btt->buckets[bucket] = index;
+    s_btt->count++;
+    s_btt->stats.used = s_btt->count;
+    if (s_btt->stats.used > s_btt->stats.high_water) {
+        s_btt->stats.high_water = s_btt->stats.used;
+    }
+    return &s_btt->entries[index];
+}
+
+static bool btt_passive_ack_complete(const btt_entry_t *entry)
+{
+    uint64_t all;
+
+    if (entry->nbr_version != s_btt->nbr_version || s_btt->router_overflow || !s_btt->router_count) {
+        return false;
+    }
+    all = s_btt->router_count == 64 ? UINT64_MAX : ((1ULL << s_btt->router_count) - 1);
+    return (entry->heard & all) == all;
+}
+
+/* The originator in the probe window of its address, or a free or the least recently updated slot for it. */
+static btt_originator_t *btt_originator_find(ezb_shortaddr_t addr, uint32_t now, uint32_t capacity)
+{
+    uint16_t slot = btt_slot(ezb_hash_mix32(addr));
+    uint16_t probes = s_btt->config.size < BTT_MAX_PROBE ? s_btt->config.size : BTT_MAX_PROBE;
+    btt_originator_t *victim = NULL;
+
+    for (uint16_t i = 0; i < probes; i++) {
+        btt_originator_t *orig = &s_btt->originators[slot];
+        if (orig->addr == addr) {
+            return orig;
+        }
+        if (!victim || (victim->addr != EZB_NWK_ADDR_UNKNOWN &&
+                        (orig->addr == EZB_NWK_ADDR_UNKNOWN ||
+                         (int32_t)(orig->last_update - victim->last_update) < 0))) {
+            victim = orig;
+        }
+        slot = (slot + 1) % s_btt->config.size;
+    }
+    *victim = (btt_originator_t){.addr = addr, .tokens = capacity, .last_update = now};
+    return victim;
+}
+
+static bool btt_originator_admit(ezb_shortaddr_t addr, uint32_t now)
+{
+    uint32_t capacity = (uint32_t)(s_btt->config.rate_burst ? s_btt->config.rate_burst : 1) * BTT_TOKEN_SCALE;
+    btt_originator_t *orig;
+    uint32_t elapsed;
+
+    if (!s_btt->config.rate_limit) {
+        return true;
+    }
+    orig = btt_originator_find(addr, now, capacity);
+
+    elapsed = now - orig->last_update;
+    orig->last_update = now;
+    /* rate_limit broadcasts per second is rate_limit tokens per BTT_TOKEN_SCALE milliseconds. */
+    if (elapsed >= capacity / s_btt->config.rate_limit) {
+        orig->tokens = capacity;
+    } else {
+        orig->tokens += elapsed * s_btt->config.rate_limit;
+        orig->tokens = orig->tokens > capacity ? capacity : orig->tokens;
+    }
+    if (orig->tokens < BTT_TOKEN_SCALE) {
+        return false;
+    }
+    orig->tokens -= BTT_TOKEN_SCALE;
+    return true;
+}
+
+static bool btt_parse_broadcast(const ezb_mac_frame_t *mhr, ezb_nwk_frame_t *nhr)
+{
+    return mhr->dst.addr_mode == EZB_ADDR_MODE_SHORT && mhr->dst.u.short_addr == EZB_RADIO_BROADCAST_SHORT_ADDR &&
+           mhr->src.addr_mode == EZB_ADDR_MODE_SHORT && ezb_nwk_frame_parse(mhr, nhr) &&
+           EZB_NWK_IS_BROADCAST_ADDR(nhr->dst);
+}
+
+/* The route discovery must not be held back, the command identifier is only known once decrypted. */
+static bool btt_is_route_request(const ezb_mac_frame_t *mhr, const ezb_nwk_frame_t *nhr)
+{
+    uint8_t plain[EZB_NWK_SECURITY_MAX_PAYLOAD];
+    uint8_t plain_len;
+    ezb_nwk_security_t sec;
+
+    return nhr->type == EZB_NWK_FRAME_TYPE_COMMAND && nhr->security && ezb_nwk_security_parse(mhr, &sec) &&
+           ezb_nwk_security_decrypt(&sec, plain, &plain_len) == EZB_ERR_NONE && plain_len &&
+           plain[0] == NWK_CMD_ROUTE_REQUEST;
+}
+
+static void btt_radio_rx(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr)
+{
+    ezb_nwk_frame_t nhr;
+    btt_entry_t *entry;
+
+    if (!btt_parse_broadcast(mhr, &nhr)) {
+        return;
+    }
+    entry = btt_lookup(nhr.src, nhr.seq, ezb_plat_milli_alarm_get_now());
+    if (!entry || entry->nbr_version != s_btt->nbr_version) {
+        return;
+    }
+    for (uint8_t i = 0; i < s_btt->router_count; i++) {
+        if (s_btt->routers[i] == mhr->src.u.short_addr) {
+            entry->heard |= 1ULL << i;
+            break;
+        }
+    }
+}
+
+static bool btt_radio_tx(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr)
+{
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+    ezb_nwk_frame_t nhr;
+    btt_entry_t *entry;
+    bool relay;
+
+    if (!btt_parse_broadcast(mhr, &nhr)) {
+        return true;
+    }
+    relay = nhr.src != ezb_nwk_get_short_address();
+    entry = btt_lookup(nhr.src, nhr.seq, now);
+
+    if (entry) {
+        if (entry->dropped) {
+            s_btt->stats.rate_limited++;
+            return false;
+        }
+        if (entry->tx_count == 0) {
+            if (relay && s_btt->config.rate_limit && !btt_is_route_request(mhr, &nhr) &&
+                !btt_originator_admit(nhr.src, now)) {
+                entry->dropped = true;
+                s_btt->stats.rate_limited++;
+                return false;
+            }
+        } else if (btt_passive_ack_complete(entry)) {
+            s_btt->stats.suppressed++;
+            return false;
+        }
+    }
+
+    /* An untracked broadcast cannot be told from its retransmissions, each transmission is counted. */
+    if (entry && entry->tx_count) {
+        s_btt->stats.retransmissions++;
+    } else if (relay) {
+        s_btt->stats.rebroadcasts++;
+    } else {
+        s_btt->stats.broadcasts++;
+    }
+    if (entry) {
+        entry->tx_count++;
+    }
+    return true;
+}
+
+ezb_err_t ezb_nwk_btt_init(const ezb_nwk_btt_config_t *config)
+{
+    if (!config || !config->size || config->size == BTT_INDEX_NONE || !config->entry_timeout) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_btt) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_btt = calloc(1, sizeof(btt_ctx_t));
+    if (!s_btt) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_btt->entries = calloc(config->size, sizeof(btt_entry_t));
+    s_btt->buckets = calloc(config->size, sizeof(uint16_t));
+    s_btt->originators = calloc(config->size, sizeof(btt_originator_t));
+    if (!s_btt->entries || !s_btt->buckets || !s_btt->originators) {
+        free(s_btt->entries);
+        free(s_btt->buckets);
+        free(s_btt->originators);
+        free(s_btt);
+        s_btt = NULL;
+        return EZB_ERR_NO_MEM;
+    }
+    for (uint16_t i = 0; i < config->size; i++) {
+        s_btt->buckets[i] = BTT_INDEX_NONE;
+        s_btt->originators[i].addr = EZB_NWK_ADDR_UNKNOWN;
+    }
+
+    s_btt->config = *config;
+    s_btt->stats.size = config->size;
+    s_btt->hook.rx = btt_radio_rx;
+    s_btt->hook.tx = btt_radio_tx;
+    ezb_mac_radio_hook_register(&s_btt->hook);
+    return EZB_ERR_NONE;
+}
+
+void ezb_nwk_btt_deinit(void)
+{
+    if (!s_btt) {
+        return;
+    }
+    ezb_mac_radio_hook_unregister(&s_btt->hook);
+    free(s_btt->entries);
+    free(s_btt->buckets);
+    free(s_btt->originators);
+    free(s_btt);
+    s_btt = NULL;
+}
+
+void ezb_nwk_btt_get_stats(ezb_nwk_btt_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_btt) {
+        memset(stats, 0, sizeof(ezb_nwk_btt_stats_t));
+        return;
+    }
+    *stats = s_btt->stats;
+}
+
+void ezb_nwk_btt_reset_stats(void)
+{
+    if (!s_btt) {
+        return;
+    }
+    s_btt->stats.high_water = s_btt->stats.used;
+    s_btt->stats.broadcasts = 0;
+    s_btt->stats.rebroadcasts = 0;
+    s_btt->stats.retransmissions = 0;
+    s_btt->stats.suppressed = 0;
+    s_btt->stats.rate_limited = 0;
+    s_btt->stats.table_full = 0;
+}
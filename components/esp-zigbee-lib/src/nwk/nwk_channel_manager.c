@@ -0,0 +1,342 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/platform/alarm.h>
+#include <ezbee/zdo/zdo_nwk_mgmt.h>
+#include <ezbee/nwk/nwk_channel_manager.h>
+
+#include "mac/mac_radio_hook.h"
+#include "utils/ezb_timer.h"
+
+#define CM_CHANNEL_COUNT       (EZB_RADIO_2P4GHZ_CHANNEL_MAX - EZB_RADIO_2P4GHZ_CHANNEL_MIN + 1)
+#define CM_CHANNEL_INDEX(ch)   ((ch) - EZB_RADIO_2P4GHZ_CHANNEL_MIN)
+#define CM_COORDINATOR_ADDR    0x0000U
+#define CM_RX_ON_WHEN_IDLE     0xFFFDU
+#define CM_CHANNEL_CHANGE_SCAN 0xFEU
+#define CM_REPORT_TIMEOUT_MS   10000U
+
+typedef enum {
+    CM_STATE_IDLE,
+    CM_STATE_SCANNING,
+    CM_STATE_POLLING,
+} cm_state_t;
+
+typedef struct cm_ctx_s {
+    ezb_nwk_channel_manager_config_t config;
+    ezb_nwk_channel_manager_stats_t stats;
+    ezb_mac_radio_hook_t hook;
+    cm_state_t state;
+    uint32_t window_tx;
+    uint32_t window_failures;
+    uint8_t suspect;            /* Number of consecutive suspect windows */
+    uint32_t last_change;
+    bool changed;
+    ezb_shortaddr_t *routers;   /* Router neighbors to poll in the current survey */
+    uint8_t router_count;
+    uint8_t router_index;
+    uint32_t token;             /* Identifies the pending scan or report, stale callbacks are ignored */
+    int8_t energy[CM_CHANNEL_COUNT];
+} cm_ctx_t;
+
+static cm_ctx_t *s_cm;
+static ezb_timer_t s_cm_timer;
+static ezb_timer_t s_cm_report_timer;
+
+static void cm_poll_next(void);
+
+static bool cm_is_network_manager(void)
+{
+    return ezb_nwk_get_short_address() == CM_COORDINATOR_ADDR;
+}
+
+static void cm_radio_tx_done(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr, const ezb_radio_frame_t *ack,
+                             ezb_err_t error)
+{
+    if (!mhr->ack_request) {
+        return;
+    }
+    if (error == EZB_ERR_NONE) {
+        s_cm->window_tx++;
+    } else if (error == EZB_ERR_MAC_NO_ACK || error == EZB_ERR_MAC_CHANNEL_ACCESS_FAILURE) {
+        s_cm->window_tx++;
+        s_cm->window_failures++;
+    }
+}
+
+static void cm_energy_sample(uint8_t channel, int8_t energy)
+{
+    if (channel < EZB_RADIO_2P4GHZ_CHANNEL_MIN || channel > EZB_RADIO_2P4GHZ_CHANNEL_MAX ||
+        !(s_cm->config.channel_mask & (1U << channel))) {
+        return;
+    }
+    if (energy > s_cm->energy[CM_CHANNEL_INDEX(channel)]) {
+        s_cm->energy[CM_CHANNEL_INDEX(channel)] = energy;
+    }
+}
+
+static void cm_change_channel(uint8_t channel)
+{
+    uint8_t update_id = ezb_nwk_get_update_id() + 1;
+    ezb_zdo_nwk_mgmt_nwk_update_req_t req = {
+        .dst_nwk_addr = CM_RX_ON_WHEN_IDLE,
+        .field = {
+            .scan_channels = 1U << channel,
+            .scan_duration = CM_CHANNEL_CHANGE_SCAN,
+            .nwk_update_id = update_id,
+        },
+        .cb = NULL,
+    };
+
+    if (ezb_zdo_nwk_mgmt_nwk_update_req(&req) != EZB_ERR_NONE) {
+        return;
+    }
+    ezb_nwk_set_update_id(update_id);
+    s_cm->stats.last_channel = ezb_nwk_get_current_channel();
+    s_cm->stats.channel_changes++;
+    s_cm->last_change = ezb_plat_milli_alarm_get_now();
+    s_cm->changed = true;
+}
+
+static void cm_survey_done(void)
+{
+    uint8_t current = ezb_nwk_get_current_channel();
+    uint8_t best = 0;
+
+    s_cm->state = CM_STATE_IDLE;
+    s_cm->suspect = 0;
+    memcpy(s_cm->stats.energy, s_cm->energy, sizeof(s_cm->energy));
+
+    if (current < EZB_RADIO_2P4GHZ_CHANNEL_MIN || current > EZB_RADIO_2P4GHZ_CHANNEL_MAX ||
+        s_cm->energy[CM_CHANNEL_INDEX(current)] == INT8_MIN || !cm_is_network_manager()) {
+        return;
+    }
+    for (uint8_t ch = EZB_RADIO_2P4GHZ_CHANNEL_MIN; ch <= EZB_RADIO_2P4GHZ_CHANNEL_MAX; ch++) {
+        if (ch == current || s_cm->energy[CM_CHANNEL_INDEX(ch)] == INT8_MIN) {
+            continue;
+        }
+        if (!best || s_cm->energy[CM_CHANNEL_INDEX(ch)] < s_cm->energy[CM_CHANNEL_INDEX(best)]) {
+            best = ch;
+        }
+    }
+    if (!best || (int)s_cm->energy[CM_CHANNEL_INDEX(current)] - s_cm->energy[CM_CHANNEL_INDEX(best)] <
+                     (int)s_cm->config.hysteresis) {
+        return;
+    }
+    if (s_cm->changed &&
+        ezb_plat_milli_alarm_get_now() - s_cm->last_change < (uint32_t)s_cm->config.holdoff * 1000U) {
+        return;
+    }
+    cm_change_channel(best);
+}
+
+static void cm_report_cb(const ezb_zdo_nwk_mgmt_nwk_update_req_result_t *result, void *user_ctx)
+{
+    const ezb_zdp_nwk_mgmt_nwk_update_notify_field_t *rsp = result->rsp;
+    uint8_t index = 0;
+
+    if (!s_cm || s_cm->state != CM_STATE_POLLING || (uint32_t)(uintptr_t)user_ctx != s_cm->token) {
+        return;
+    }
+    if (result->error == EZB_ERR_NONE && rsp && rsp->status == EZB_ZDP_STATUS_SUCCESS) {
+        s_cm->stats.reports++;
+        s_cm->stats.report_tx_total += rsp->total_transmissions;
+        s_cm->stats.report_tx_failures += rsp->transmissions_failure;
+        /* The energy values are listed in the order of the channels set in the scanned channel mask. */
+        for (uint8_t ch = EZB_RADIO_2P4GHZ_CHANNEL_MIN; ch <= EZB_RADIO_2P4GHZ_CHANNEL_MAX; ch++) {
+            if (!(rsp->scanned_channels & (1U << ch))) {
+                continue;
+            }
+            if (index >= rsp->scanned_channels_list_count || index >= sizeof(rsp->energy_values)) {
+                break;
+            }
+            cm_energy_sample(ch, rsp->energy_values[index++]);
+        }
+    }
+    ezb_timer_stop(&s_cm_report_timer);
+    s_cm->router_index++;
+    cm_poll_next();
+}
+
+static void cm_report_timeout(void *ctx)
+{
+    if (s_cm->state != CM_STATE_POLLING) {
+        return;
+    }
+    s_cm->router_index++;
+    cm_poll_next();
+}
+
+static void cm_poll_next(void)
+{
+    while (s_cm->router_index < s_cm->router_count) {
+        ezb_zdo_nwk_mgmt_nwk_update_req_t req = {
+            .dst_nwk_addr = s_cm->routers[s_cm->router_index],
+            .field = {
+                .scan_channels = s_cm->config.channel_mask,
+                .scan_duration = s_cm->config.scan_duration,
+                .scan_count = 1,
+                .nwk_update_id = ezb_nwk_get_update_id(),
+            },
+            .cb = cm_report_cb,
+            .user_ctx = (void *)(uintptr_t)++s_cm->token,
+        };
+        if (ezb_zdo_nwk_mgmt_nwk_update_req(&req) == EZB_ERR_NONE) {
+            ezb_timer_start(&s_cm_report_timer, CM_REPORT_TIMEOUT_MS);
+            return;
+        }
+        s_cm->router_index++;
+    }
+    cm_survey_done();
+}
+
+static void cm_ed_scan_cb(ezb_nwk_ed_scan_result_t *result, void *user_ctx)
+{
+    if (!s_cm || s_cm->state != CM_STATE_SCANNING || (uint32_t)(uintptr_t)user_ctx != s_cm->token) {
+        return;
+    }
+    if (result) {
+        cm_energy_sample(result->channel_number, result->max_rssi);
+        return;
+    }
+    s_cm->state = CM_STATE_POLLING;
+    cm_poll_next();
+}
+
+static void cm_survey_start(void)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_neighbor_info_t nbr = {};
+    ezb_nwk_scan_req_t req = {
+        .scan_type = EZB_NWK_SCAN_TYPE_ED,
+        .scan_duration = s_cm->config.scan_duration,
+        .scan_channels = s_cm->config.channel_mask,
+        .ed_scan_cb = cm_ed_scan_cb,
+    };
+
+    s_cm->stats.surveys++;
+    memset(s_cm->energy, INT8_MIN, sizeof(s_cm->energy));
+    s_cm->router_count = 0;
+    s_cm->router_index = 0;
+    while (s_cm->router_count < s_cm->config.max_reports && ezb_nwk_get_next_neighbor(&itor, &nbr) == EZB_ERR_NONE) {
+        if (nbr.device_type == EZB_NWK_DEVICE_TYPE_ROUTER) {
+            s_cm->routers[s_cm->router_count++] = nbr.short_addr;
+        }
+    }
+
+    s_cm->state = CM_STATE_SCANNING;
+    req.user_ctx = (void *)(uintptr_t)++s_cm->token;
+    if (ezb_nwk_scan(&req) != EZB_ERR_NONE) {
+        s_cm->state = CM_STATE_POLLING;
+        cm_poll_next();
+    }
+}
+
+static void cm_check(void *ctx)
+{
+    s_cm->stats.tx_frames = s_cm->window_tx;
+    s_cm->stats.tx_failures = s_cm->window_failures;
+    s_cm->window_tx = 0;
+    s_cm->window_failures = 0;
+    ezb_timer_start(&s_cm_timer, (uint32_t)s_cm->config.check_interval * 1000U);
+
+    if (s_cm->stats.tx_frames < s_cm->config.min_tx_frames ||
+        s_cm->stats.tx_failures * 100U < s_cm->stats.tx_frames * s_cm->config.failure_threshold) {
+        s_cm->suspect = 0;
+        return;
+    }
+    s_cm->stats.suspect_windows++;
+    if (s_cm->suspect < UINT8_MAX) {
+        s_cm->suspect++;
+    }
+    if (s_cm->suspect >= s_cm->config.confirm_checks && s_cm->state == CM_STATE_IDLE && cm_is_network_manager()) {
+        cm_survey_start();
+    }
+}
+
+ezb_err_t ezb_nwk_channel_manager_init(const ezb_nwk_channel_manager_config_t *config)
+{
+    if (!config || !(config->channel_mask & EZB_RADIO_2P4GHZ_ALL_CHANNEL_MASK) ||
+        (config->channel_mask & ~(uint32_t)EZB_RADIO_2P4GHZ_ALL_CHANNEL_MASK) || !config->check_interval ||
+        !config->failure_threshold || config->failure_threshold > 100 || !config->confirm_checks ||
+        config->scan_duration > 5) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_cm) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_cm = calloc(1, sizeof(cm_ctx_t));
+    if (!s_cm) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_cm->routers = calloc(config->max_reports ? config->max_reports : 1, sizeof(ezb_shortaddr_t));
+    if (!s_cm->routers) {
+        goto error;
+    }
+    if (!ezb_timer_init(&s_cm_timer, "zb_chm", cm_check, NULL)) {
+        goto error;
+    }
+    if (!ezb_timer_init(&s_cm_report_timer, "zb_chm_rpt", cm_report_timeout, NULL)) {
+        ezb_timer_deinit(&s_cm_timer);
+        goto error;
+    }
+
+    s_cm->config = *config;
+    memset(s_cm->energy, INT8_MIN, sizeof(s_cm->energy));
+    memset(s_cm->stats.energy, INT8_MIN, sizeof(s_cm->stats.energy));
+    s_cm->hook.tx_done = cm_radio_tx_done;
+    ezb_mac_radio_hook_register(&s_cm->hook);
+    ezb_timer_start(&s_cm_timer, (uint32_t)config->check_interval * 1000U);
+    return EZB_ERR_NONE;
+
+error:
+    free(s_cm->routers);
+    free(s_cm);
+    s_cm = NULL;
+    return EZB_ERR_NO_MEM;
+}
+
+void ezb_nwk_channel_manager_deinit(void)
+{
+    if (!s_cm) {
+        return;
+    }
+    ezb_timer_deinit(&s_cm_timer);
+    ezb_timer_deinit(&s_cm_report_timer);
+    ezb_mac_radio_hook_unregister(&s_cm->hook);
+    free(s_cm->routers);
+    free(s_cm);
+    s_cm = NULL;
+}
+
+ezb_err_t ezb_nwk_channel_manager_survey(void)
+{
+    if (!s_cm || !cm_is_network_manager()) {
+        return EZB_ERR_INV_STATE;
+    }
+    if (s_cm->state != CM_STATE_IDLE) {
+        return EZB_ERR_BUSY;
+    }
+    cm_survey_start();
+    return EZB_ERR_NONE;
+}
+
+void ezb_nwk_channel_manager_get_stats(ezb_nwk_channel_manager_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_cm) {
+        memset(stats, 0, sizeof(ezb_nwk_channel_manager_stats_t));
+        memset(stats->energy, INT8_MIN, sizeof(stats->energy));
+        return;
+    }
+    *stats = s_cm->stats;
+}
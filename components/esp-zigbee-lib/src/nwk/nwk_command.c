@@ -0,0 +1,49 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "nwk/nwk_command.h"
+#include "nwk/nwk_security.h"
+
+/* Zigbee specification 3.4.8, the link status command */
+#define NWK_CMD_LINK_STATUS            0x08U
+#define NWK_LINK_STATUS_DST            0xFFFCU /* All routers and the coordinator */
+#define NWK_LINK_STATUS_COUNT_MASK     0x1FU
+#define NWK_LINK_STATUS_ENTRY_SIZE     3U
+#define NWK_LINK_STATUS_COST_MASK      0x07U
+#define NWK_LINK_STATUS_OUT_COST_SHIFT 4U
+
+bool ezb_nwk_link_status_parse(const ezb_mac_frame_t *mac, ezb_shortaddr_t addr, ezb_nwk_link_status_entry_t *entry)
+{
+    uint8_t plain[EZB_NWK_SECURITY_MAX_PAYLOAD];
+    uint8_t plain_len;
+    ezb_nwk_security_t sec;
+    ezb_nwk_frame_t nwk;
+    uint8_t count;
+
+    if (mac->src.addr_mode != EZB_ADDR_MODE_SHORT || !ezb_nwk_frame_parse(mac, &nwk) ||
+        nwk.type != EZB_NWK_FRAME_TYPE_COMMAND || !nwk.security || nwk.dst != NWK_LINK_STATUS_DST ||
+        nwk.radius != 1 || nwk.src != mac->src.u.short_addr) {
+        return false;
+    }
+    if (!ezb_nwk_security_parse(mac, &sec) || ezb_nwk_security_decrypt(&sec, plain, &plain_len) != EZB_ERR_NONE ||
+        plain_len < 2 || plain[0] != NWK_CMD_LINK_STATUS) {
+        return false;
+    }
+
+    count = plain[1] & NWK_LINK_STATUS_COUNT_MASK;
+    if (plain_len < 2 + count * NWK_LINK_STATUS_ENTRY_SIZE) {
+        return false;
+    }
+    for (const uint8_t *pos = plain + 2; count--; pos += NWK_LINK_STATUS_ENTRY_SIZE) {
+        if ((pos[0] | (pos[1] << 8)) == addr) {
+            entry->sender = nwk.src;
+            entry->incoming_cost = pos[2] & NWK_LINK_STATUS_COST_MASK;
+            entry->outgoing_cost = (pos[2] >> NWK_LINK_STATUS_OUT_COST_SHIFT) & NWK_LINK_STATUS_COST_MASK;
+            return true;
+        }
+    }
+    return false;
+}
@@ -0,0 +1,45 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <ezbee/core_types.h>
+
+#include "mac/mac_frame.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The entry for this device in a link status command received from a router neighbor.
+ */
+typedef struct ezb_nwk_link_status_entry_s {
+    ezb_shortaddr_t sender;     /* The router neighbor that sent the link status */
+    uint8_t incoming_cost;      /* The cost of the link from this device to the sender, as seen by the sender */
+    uint8_t outgoing_cost;      /* The cost of the link from the sender to this device, as seen by the sender */
+} ezb_nwk_link_status_entry_t;
+
+/**
+ * @brief Decode the entry of a device in a received link status command.
+ *
+ * Only the frames that can be a link status command are decrypted: secured NWK commands broadcast to the routers,
+ * with a radius of 1, from the MAC source. A link status split over several frames lists @p addr in one of them.
+ *
+ * @param[in]  mac   The MAC frame, received from the radio.
+ * @param[in]  addr  The short address of the device whose entry is looked up.
+ * @param[out] entry The entry of @p addr.
+ *
+ * @return True if the frame is an authentic link status command listing @p addr.
+ */
+bool ezb_nwk_link_status_parse(const ezb_mac_frame_t *mac, ezb_shortaddr_t addr, ezb_nwk_link_status_entry_t *entry);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
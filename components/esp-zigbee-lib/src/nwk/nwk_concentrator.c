@@ -0,0 +1,188 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <ezbee/app_signals.h>
+#include <ezbee/nwk.h>
+
+#include "utils/ezb_timer.h"
+
+#define CONCENTRATOR_DEFAULT_RADIUS 30U
+/* The stack sends a request of its own about this many seconds after the last one, on a ticker of about a second. */
+#define CONCENTRATOR_STACK_DISC_TIME UINT8_MAX
+/* The intervals stay well below it, so that every request is one of the scheduling. */
+#define CONCENTRATOR_MAX_INTERVAL    240U
+
+typedef struct concentrator_ctx_s {
+    ezb_nwk_concentrator_adaptive_config_t config;
+    ezb_nwk_concentrator_stats_t stats;
+    uint32_t route_record_generation;
+    uint16_t interval;
+    bool started;
+    bool first;
+    bool event_pending;     /* A topology event occurred since the last request */
+} concentrator_ctx_t;
+
+static concentrator_ctx_t s_cnctr;
+static ezb_timer_t s_cnctr_timer;
+
+static uint16_t route_record_count(void)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_route_record_info_t rrec = {};
+    uint16_t count = 0;
+
+    while (ezb_nwk_get_next_route_record(&itor, &rrec) == EZB_ERR_NONE) {
+        count++;
+    }
+    return count;
+}
+
+/* The requests refresh the route records, the routes of the concentrator itself do not depend on them. */
+static void concentrator_tick(void *ctx)
+{
+    uint32_t route_record_generation = ezb_nwk_get_route_record_table_generation();
+    bool changed = s_cnctr.first || route_record_generation != s_cnctr.route_record_generation;
+
+    if (!s_cnctr.first) {
+        if (changed) {
+            s_cnctr.stats.route_record_changes++;
+        }
+        if (s_cnctr.event_pending) {
+            s_cnctr.interval = s_cnctr.config.min_interval;
+        } else if (!changed) {
+            uint32_t interval = (uint32_t)s_cnctr.interval * 2;
+            s_cnctr.interval = interval > s_cnctr.config.max_interval ? s_cnctr.config.max_interval : interval;
+        }
+    }
+    s_cnctr.route_record_generation = route_record_generation;
+    if (changed) {
+        s_cnctr.stats.route_records = route_record_count();
+    }
+
+    if (ezb_nwk_concentrator_discovery() == EZB_ERR_NONE) {
+        s_cnctr.stats.mtorr_count++;
+        if (s_cnctr.event_pending) {
+            s_cnctr.stats.mtorr_triggered++;
+        }
+    }
+    s_cnctr.first = false;
+    s_cnctr.event_pending = false;
+    s_cnctr.stats.interval = s_cnctr.interval;
+    ezb_timer_start(&s_cnctr_timer, (uint32_t)s_cnctr.interval * 1000U);
+}
+
+static void concentrator_topology_event(void)
+{
+    uint32_t holdoff = (uint32_t)s_cnctr.config.holdoff * 1000U;
+
+    s_cnctr.event_pending = true;
+    if (ezb_timer_get_remaining(&s_cnctr_timer) > holdoff) {
+        ezb_timer_start(&s_cnctr_timer, holdoff);
+    }
+}
+
+static bool concentrator_signal_handler(const ezb_app_signal_t *app_signal)
+{
+    ezb_app_signal_type_t type = ezb_app_signal_get_type(app_signal);
+
+    if (!s_cnctr.started) {
+        return false;
+    }
+
+    if (type == EZB_NWK_SIGNAL_NETWORK_STATUS) {
+        const ezb_nwk_signal_network_status_params_t *params = ezb_app_signal_get_params(app_signal);
+        switch (params->status) {
+        case EZB_NWK_NETWORK_STATUS_LEGACY_NO_ROUTE_AVAILABLE:
+        case EZB_NWK_NETWORK_STATUS_LEGACY_LINK_FAILURE:
+        case EZB_NWK_NETWORK_STATUS_LINK_FAILURE:
+        case EZB_NWK_NETWORK_STATUS_SOURCE_ROUTE_FAILURE:
+        case EZB_NWK_NETWORK_STATUS_MANY_TO_ONE_ROUTE_FAILURE:
+            s_cnctr.stats.route_errors++;
+            concentrator_topology_event();
+            break;
+        default:
+            break;
+        }
+    } else if (type == EZB_ZDO_SIGNAL_DEVICE_ANNCE) {
+        s_cnctr.stats.joins++;
+        concentrator_topology_event();
+    } else if (type == EZB_ZDO_SIGNAL_DEVICE_UNAVAILABLE) {
+        s_cnctr.stats.unavailable++;
+        concentrator_topology_event();
+    }
+
+    return false;
+}
+
+ezb_err_t ezb_nwk_concentrator_adaptive_start(const ezb_nwk_concentrator_adaptive_config_t *config)
+{
+    ezb_err_t ret = EZB_ERR_NONE;
+    uint8_t radius;
+
+    if (!config || !config->min_interval || config->max_interval < config->min_interval ||
+        config->max_interval > CONCENTRATOR_MAX_INTERVAL) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_cnctr.started) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    if (!ezb_timer_init(&s_cnctr_timer, "zb_cnctr", concentrator_tick, NULL)) {
+        return EZB_ERR_NO_MEM;
+    }
+    ret = ezb_app_signal_add_handler(concentrator_signal_handler);
+    if (ret != EZB_ERR_NONE) {
+        goto exit;
+    }
+
+    /* The stack cannot run without periodic requests, a discovery time of 0 sends one every second. With the longest
+     * discovery time, each request of the scheduling restarts the period of the stack before it elapses. */
+    radius = config->radius ? config->radius : CONCENTRATOR_DEFAULT_RADIUS;
+    ret = ezb_nwk_concentrator_start(radius, 0, CONCENTRATOR_STACK_DISC_TIME);
+    if (ret != EZB_ERR_NONE) {
+        ezb_app_signal_remove_handler(concentrator_signal_handler);
+        goto exit;
+    }
+
+    memset(&s_cnctr, 0, sizeof(s_cnctr));
+    s_cnctr.config = *config;
+    s_cnctr.interval = config->min_interval;
+    s_cnctr.first = true;
+    s_cnctr.started = true;
+    concentrator_tick(NULL);
+
+exit:
+    if (ret != EZB_ERR_NONE) {
+        ezb_timer_deinit(&s_cnctr_timer);
+    }
+    return ret;
+}
+
+ezb_err_t ezb_nwk_concentrator_adaptive_stop(void)
+{
+    if (!s_cnctr.started) {
+        return EZB_ERR_INV_STATE;
+    }
+    s_cnctr.started = false;
+    ezb_timer_deinit(&s_cnctr_timer);
+    ezb_app_signal_remove_handler(concentrator_signal_handler);
+    return ezb_nwk_concentrator_stop();
+}
+
+void ezb_nwk_concentrator_get_stats(ezb_nwk_concentrator_stats_t *stats)
+{
+    if (stats) {
+        *stats = s_cnctr.stats;
+    }
+}
+
+void ezb_nwk_concentrator_reset_stats(void)
+{
+    memset(&s_cnctr.stats, 0, sizeof(s_cnctr.stats));
+    s_cnctr.stats.interval = s_cnctr.interval;
+}
@@ -0,0 +1,218 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/app_signals.h>
+#include <ezbee/bdb.h>
+#include <ezbee/core.h>
+#include <ezbee/platform/alarm.h>
+#include <ezbee/platform/radio.h>
+#include <ezbee/nwk/nwk_fast_rejoin.h>
+#include <ezbee/nwk/nwk_fast_scan.h>
+
+#include "mac/mac_frame.h"
+#include "mac/mac_radio_hook.h"
+#include "utils/ezb_timer.h"
+
+#define FAST_REJOIN_DEFAULT_FIRST_PACKET_TIMEOUT 5000U
+
+typedef struct fast_rejoin_ctx_s {
+    ezb_nwk_fast_rejoin_config_t config;
+    ezb_nwk_fast_rejoin_result_t result;
+    ezb_mac_radio_hook_t hook;
+    uint32_t stage_masks[EZB_NWK_FAST_REJOIN_STAGE_MAX_NR];
+    uint32_t saved_mask;
+    uint8_t saved_scan_duration;
+    uint32_t start_time;
+    bool rejoined;
+    bool first_packet;
+} fast_rejoin_ctx_t;
+
+static fast_rejoin_ctx_t *s_fast_rejoin;
+static ezb_timer_t s_fast_rejoin_timer;
+
+static void fast_rejoin_restore(void)
+{
+    ezb_set_channel_mask(s_fast_rejoin->saved_mask);
+    ezb_bdb_set_scan_duration(s_fast_rejoin->saved_scan_duration);
+}
+
+static bool fast_rejoin_signal_handler(const ezb_app_signal_t *app_signal);
+
+static void fast_rejoin_finish(void *ctx)
+{
+    ezb_nwk_fast_rejoin_result_t result;
+    ezb_nwk_fast_rejoin_config_t config;
+
+    if (!s_fast_rejoin) {
+        return;
+    }
+    result = s_fast_rejoin->result;
+    config = s_fast_rejoin->config;
+    ezb_timer_deinit(&s_fast_rejoin_timer);
+    ezb_mac_radio_hook_unregister(&s_fast_rejoin->hook);
+    ezb_app_signal_remove_handler(fast_rejoin_signal_handler);
+    free(s_fast_rejoin);
+    s_fast_rejoin = NULL;
+
+    if (config.cb) {
+        config.cb(&result, config.user_ctx);
+    }
+}
+
+static void fast_rejoin_radio_tx_done(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr,
+                                      const ezb_radio_frame_t *ack, ezb_err_t error)
+{
+    /* Only a data frame shows that the device talks on the network again, a data poll is a MAC command. */
+    if (!s_fast_rejoin->rejoined || s_fast_rejoin->first_packet || mhr->type != EZB_MAC_FRAME_TYPE_DATA ||
+        !mhr->ack_request || error != EZB_ERR_NONE) {
+        return;
+    }
+    s_fast_rejoin->first_packet = true;
+    s_fast_rejoin->result.first_packet_time = ezb_plat_milli_alarm_get_now() - s_fast_rejoin->start_time;
+    /* Report from the task queue, the callback may transmit. */
+    ezb_timer_start(&s_fast_rejoin_timer, 0);
+}
+
+static ezb_err_t fast_rejoin_run_stage(void)
+{
+    ezb_nwk_fast_rejoin_stage_t stage = s_fast_rejoin->result.stage;
+
+    ezb_set_channel_mask(s_fast_rejoin->stage_masks[stage]);
+    if (stage == EZB_NWK_FAST_REJOIN_STAGE_CACHED) {
+        ezb_bdb_set_scan_duration(s_fast_rejoin->config.cached_scan_duration);
+    } else {
+        ezb_bdb_set_scan_duration(s_fast_rejoin->saved_scan_duration);
+    }
+    return ezb_bdb_start_top_level_commissioning(EZB_BDB_MODE_INITIALIZATION);
+}
+
+static void fast_rejoin_next_stage(void *ctx)
+{
+    if (!s_fast_rejoin) {
+        return;
+    }
+    while (++s_fast_rejoin->result.stage < EZB_NWK_FAST_REJOIN_STAGE_MAX_NR) {
+        ezb_nwk_fast_rejoin_stage_t stage = s_fast_rejoin->result.stage;
+        /* Skip a stage that scans no more channels than the previous one. */
+        if (s_fast_rejoin->stage_masks[stage] == s_fast_rejoin->stage_masks[stage - 1] ||
+            !s_fast_rejoin->stage_masks[stage]) {
+            continue;
+        }
+        if (fast_rejoin_run_stage() == EZB_ERR_NONE) {
+            return;
+        }
+    }
+    s_fast_rejoin->result.stage = EZB_NWK_FAST_REJOIN_STAGE_FULL;
+    s_fast_rejoin->result.error = EZB_ERR_FAIL;
+    s_fast_rejoin->result.rejoin_time = ezb_plat_milli_alarm_get_now() - s_fast_rejoin->start_time;
+    fast_rejoin_restore();
+    fast_rejoin_finish(NULL);
+}
+
+static void fast_rejoin_timer_expired(void *ctx)
+{
+    if (!s_fast_rejoin) {
+        return;
+    }
+    /* Once rejoined, the timer reports the result, at the first data frame or at the deadline without one. */
+    if (s_fast_rejoin->rejoined) {
+        fast_rejoin_finish(NULL);
+    } else {
+        fast_rejoin_next_stage(NULL);
+    }
+}
+
+static bool fast_rejoin_signal_handler(const ezb_app_signal_t *app_signal)
+{
+    ezb_bdb_comm_status_t status;
+
+    if (!s_fast_rejoin || s_fast_rejoin->rejoined ||
+        ezb_app_signal_get_type(app_signal) != EZB_BDB_SIGNAL_DEVICE_REBOOT) {
+        return false;
+    }
+
+    status = *((ezb_bdb_comm_status_t *)ezb_app_signal_get_params(app_signal));
+    if (status == EZB_BDB_STATUS_SUCCESS) {
+        s_fast_rejoin->rejoined = true;
+        s_fast_rejoin->result.channel = ezb_nwk_get_current_channel();
+        s_fast_rejoin->result.rejoin_time = ezb_plat_milli_alarm_get_now() - s_fast_rejoin->start_time;
+        ezb_nwk_fast_scan_set_hint(s_fast_rejoin->result.channel);
+        fast_rejoin_restore();
+        ezb_timer_start(&s_fast_rejoin_timer, s_fast_rejoin->config.first_packet_timeout
+                                                  ? s_fast_rejoin->config.first_packet_timeout
+                                                  : FAST_REJOIN_DEFAULT_FIRST_PACKET_TIMEOUT);
+    } else {
+        /* Do not restart the commissioning from the signal dispatch. */
+        ezb_timer_start(&s_fast_rejoin_timer, 0);
+    }
+    return false;
+}
+
+ezb_err_t ezb_nwk_fast_rejoin_start(const ezb_nwk_fast_rejoin_config_t *config)
+{
+    uint8_t channel = ezb_nwk_get_current_channel();
+    ezb_err_t ret;
+
+    if (!config || (config->restricted_channels & ~(uint32_t)EZB_RADIO_2P4GHZ_ALL_CHANNEL_MASK)) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_fast_rejoin) {
+        return EZB_ERR_BUSY;
+    }
+    if (ezb_bdb_is_factory_new() || channel < EZB_RADIO_2P4GHZ_CHANNEL_MIN || channel > EZB_RADIO_2P4GHZ_CHANNEL_MAX) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_fast_rejoin = calloc(1, sizeof(fast_rejoin_ctx_t));
+    if (!s_fast_rejoin) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_fast_rejoin->config = *config;
+    s_fast_rejoin->saved_mask = ezb_get_channel_mask();
+    s_fast_rejoin->saved_scan_duration = ezb_bdb_get_scan_duration();
+    s_fast_rejoin->stage_masks[EZB_NWK_FAST_REJOIN_STAGE_CACHED] = 1U << channel;
+    s_fast_rejoin->stage_masks[EZB_NWK_FAST_REJOIN_STAGE_RESTRICTED] =
+        (config->restricted_channels ? config->restricted_channels : ezb_bdb_get_primary_channel_set()) |
+        (1U << channel);
+    s_fast_rejoin->stage_masks[EZB_NWK_FAST_REJOIN_STAGE_FULL] = s_fast_rejoin->saved_mask | (1U << channel);
+    s_fast_rejoin->start_time = ezb_plat_milli_alarm_get_now();
+    s_fast_rejoin->result.stage = EZB_NWK_FAST_REJOIN_STAGE_CACHED;
+
+    if (!ezb_timer_init(&s_fast_rejoin_timer, "zb_rejoin", fast_rejoin_timer_expired, NULL)) {
+        ret = EZB_ERR_NO_MEM;
+        goto exit;
+    }
+    ret = ezb_app_signal_add_handler(fast_rejoin_signal_handler);
+    if (ret != EZB_ERR_NONE) {
+        ezb_timer_deinit(&s_fast_rejoin_timer);
+        goto exit;
+    }
+    s_fast_rejoin->hook.tx_done = fast_rejoin_radio_tx_done;
+    ezb_mac_radio_hook_register(&s_fast_rejoin->hook);
+
+    ret = fast_rejoin_run_stage();
+    if (ret != EZB_ERR_NONE) {
+        ezb_mac_radio_hook_unregister(&s_fast_rejoin->hook);
+        ezb_app_signal_remove_handler(fast_rejoin_signal_handler);
+        ezb_timer_deinit(&s_fast_rejoin_timer);
+        fast_rejoin_restore();
+    }
+
+exit:
+    if (ret != EZB_ERR_NONE) {
+        free(s_fast_rejoin);
+        s_fast_rejoin = NULL;
+    }
+    return ret;
+}
+
+bool ezb_nwk_fast_rejoin_in_progress(void)
+{
+    return s_fast_rejoin != NULL;
+}
@@ -0,0 +1,168 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "esp_zigbee.h"
+
+#include <ezbee/platform/radio.h>
+#include <ezbee/nwk/nwk_fast_scan.h>
+
+#define FAST_SCAN_CHANNEL_COUNT (EZB_RADIO_2P4GHZ_CHANNEL_MAX - EZB_RADIO_2P4GHZ_CHANNEL_MIN + 1)
+
+typedef struct fast_scan_ctx_s {
+    ezb_nwk_fast_scan_req_t req;
+    uint8_t channels[FAST_SCAN_CHANNEL_COUNT];
+    uint8_t count;
+    uint8_t index;
+    bool matched;
+} fast_scan_ctx_t;
+
+static fast_scan_ctx_t *s_fast_scan;
+static uint8_t s_fast_scan_hint;
+
+static bool fast_scan_is_valid_channel(uint8_t channel)
+{
+    return channel >= EZB_RADIO_2P4GHZ_CHANNEL_MIN && channel <= EZB_RADIO_2P4GHZ_CHANNEL_MAX;
+}
+
+static void fast_scan_add_channel(fast_scan_ctx_t *ctx, uint8_t channel, uint32_t *pending)
+{
+    if (fast_scan_is_valid_channel(channel) && (*pending & (1U << channel))) {
+        ctx->channels[ctx->count++] = channel;
+        *pending &= ~(1U << channel);
+    }
+}
+
+static bool fast_scan_match(const ezb_nwk_active_scan_result_t *result)
+{
+    ezb_nwk_fast_scan_match_t match = s_fast_scan->req.match;
+
+    if (!match) {
+        return false;
+    }
+    if ((match & EZB_NWK_FAST_SCAN_MATCH_EXTPANID) &&
+        !ezb_eui64_compare(&result->extpanid, &s_fast_scan->req.extpanid)) {
+        return false;
+    }
+    if ((match & EZB_NWK_FAST_SCAN_MATCH_PERMIT_JOIN) && !result->permit_join) {
+        return false;
+    }
+    if ((match & EZB_NWK_FAST_SCAN_MATCH_ROUTER_CAPACITY) && !result->router_capacity) {
+        return false;
+    }
+    if ((match & EZB_NWK_FAST_SCAN_MATCH_ENDDEV_CAPACITY) && !result->enddev_capacity) {
+        return false;
+    }
+    return true;
+}
+
+static void fast_scan_finish(void)
+{
+    ezb_nwk_active_scan_callback_t cb = s_fast_scan->req.active_scan_cb;
+    void *user_ctx = s_fast_scan->req.user_ctx;
+
+    free(s_fast_scan);
+    s_fast_scan = NULL;
+    cb(NULL, user_ctx);
+}
+
+static void fast_scan_channel_cb(ezb_nwk_active_scan_result_t *result, void *user_ctx);
+
+static ezb_err_t fast_scan_next_channel(void)
+{
+    ezb_nwk_scan_req_t req = {
+        .scan_type = EZB_NWK_SCAN_TYPE_ACTIVE,
+        .scan_duration = s_fast_scan->req.scan_duration,
+        .scan_channels = 1U << s_fast_scan->channels[s_fast_scan->index],
+        .active_scan_cb = fast_scan_channel_cb,
+        .user_ctx = s_fast_scan,
+    };
+
+    return ezb_nwk_scan(&req);
+}
+
+static void fast_scan_continue(void *ctx)
+{
+    if (s_fast_scan != ctx) {
+        return;
+    }
+    if (fast_scan_next_channel() != EZB_ERR_NONE) {
+        fast_scan_finish();
+    }
+}
+
+static void fast_scan_channel_cb(ezb_nwk_active_scan_result_t *result, void *user_ctx)
+{
+    if (s_fast_scan != user_ctx) {
+        return;
+    }
+    if (result) {
+        if (!s_fast_scan->matched && fast_scan_match(result)) {
+            s_fast_scan->matched = true;
+            s_fast_scan_hint = result->channel_number;
+        }
+        s_fast_scan->req.active_scan_cb(result, s_fast_scan->req.user_ctx);
+        return;
+    }
+
+    if (s_fast_scan->matched || ++s_fast_scan->index >= s_fast_scan->count) {
+        fast_scan_finish();
+        return;
+    }
+    /* The scan of the previous channel is still being completed by the stack, start the next one afterwards. */
+    if (esp_zigbee_task_queue_post(fast_scan_continue, s_fast_scan) != ESP_OK) {
+        fast_scan_finish();
+    }
+}
+
+ezb_err_t ezb_nwk_fast_scan(const ezb_nwk_fast_scan_req_t *req)
+{
+    uint32_t pending;
+    ezb_err_t ret;
+
+    if (!req || !req->active_scan_cb || (req->hint_count && !req->hint_channels)) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_fast_scan) {
+        return EZB_ERR_BUSY;
+    }
+
+    s_fast_scan = calloc(1, sizeof(fast_scan_ctx_t));
+    if (!s_fast_scan) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_fast_scan->req = *req;
+    s_fast_scan->req.hint_channels = NULL;
+    s_fast_scan->req.hint_count = 0;
+
+    pending = req->scan_channels;
+    fast_scan_add_channel(s_fast_scan, s_fast_scan_hint, &pending);
+    for (uint8_t i = 0; i < req->hint_count; i++) {
+        fast_scan_add_channel(s_fast_scan, req->hint_channels[i], &pending);
+    }
+    for (uint8_t ch = EZB_RADIO_2P4GHZ_CHANNEL_MIN; ch <= EZB_RADIO_2P4GHZ_CHANNEL_MAX; ch++) {
+        fast_scan_add_channel(s_fast_scan, ch, &pending);
+    }
+
+    ret = s_fast_scan->count ? fast_scan_next_channel() : EZB_ERR_INV_ARG;
+    if (ret != EZB_ERR_NONE) {
+        free(s_fast_scan);
+        s_fast_scan = NULL;
+    }
+    return ret;
+}
+
+void ezb_nwk_fast_scan_set_hint(uint8_t channel)
+{
+    s_fast_scan_hint = fast_scan_is_valid_channel(channel) ? channel : 0;
+}
+
+uint8_t ezb_nwk_fast_scan_get_hint(void)
+{
+    return s_fast_scan_hint;
+}
@@ -0,0 +1,204 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/bdb.h>
+#include <ezbee/platform/datasets.h>
+#include <ezbee/nwk/nwk_frame_counter.h>
+
+#include "mac/mac_radio_hook.h"
+#include "utils/ezb_timer.h"
+
+typedef struct frame_counter_ctx_s {
+    ezb_nwk_frame_counter_config_t config;
+    ezb_nwk_frame_counter_stats_t stats;
+    uint32_t persisted_counter;     /* The counter when the dataset was last written */
+    bool persisted_valid;
+    uint8_t *pending;               /* The last skipped value of the dataset */
+    uint16_t pending_length;
+    uint32_t pending_counter;       /* The counter when the skipped value was written */
+    uint32_t last_write_counter;    /* The counter at the last write requested by the stack */
+    bool overrun;
+    ezb_mac_radio_hook_t hook;
+} frame_counter_ctx_t;
+
+static frame_counter_ctx_t *s_fc;
+static ezb_timer_t s_fc_timer;
+
+/* The datasets platform function is wrapped with the linker option "--wrap", see CMakeLists.txt. */
+extern ezb_err_t __real_ezb_plat_datasets_set(uint16_t key, const uint8_t *value, uint16_t length);
+
+static ezb_err_t frame_counter_persist(const uint8_t *value, uint16_t length, uint32_t counter)
+{
+    ezb_err_t ret = __real_ezb_plat_datasets_set(EZB_DATASETS_KEY_NIB_CNTR, value, length);
+
+    if (ret == EZB_ERR_NONE) {
+        s_fc->persisted_counter = counter;
+        s_fc->persisted_valid = true;
+        s_fc->stats.reserved = counter + s_fc->config.window;
+        s_fc->stats.persisted++;
+        free(s_fc->pending);
+        s_fc->pending = NULL;
+        s_fc->pending_length = 0;
+    }
+    return ret;
+}
+
+static void frame_counter_keep_pending(const uint8_t *value, uint16_t length, uint32_t counter)
+{
+    if (length != s_fc->pending_length) {
+        uint8_t *pending = realloc(s_fc->pending, length);
+        if (!pending) {
+            /* Keep the previous copy, a flush writes an older but still reserved value. */
+            return;
+        }
+        s_fc->pending = pending;
+        s_fc->pending_length = length;
+    }
+    memcpy(s_fc->pending, value, length);
+    s_fc->pending_counter = counter;
+}
+
+ezb_err_t __wrap_ezb_plat_datasets_set(uint16_t key, const uint8_t *value, uint16_t length)
+{
+    uint32_t counter;
+
+    if (!s_fc || key != EZB_DATASETS_KEY_NIB_CNTR || !length) {
+        return __real_ezb_plat_datasets_set(key, value, length);
+    }
+
+    s_fc->stats.writes++;
+    counter = ezb_nwk_get_frame_counter();
+    if (s_fc->stats.writes > 1 && counter - s_fc->last_write_counter > s_fc->stats.max_gap) {
+        s_fc->stats.max_gap = counter - s_fc->last_write_counter;
+    }
+    s_fc->last_write_counter = counter;
+    /* Write once per half window, so that the stored value always reserves the counters in use. */
+    if (!s_fc->persisted_valid || counter - s_fc->persisted_counter >= s_fc->config.window / 2) {
+        return frame_counter_persist(value, length, counter);
+    }
+    frame_counter_keep_pending(value, length, counter);
+    s_fc->stats.skipped++;
+    return EZB_ERR_NONE;
+}
+
+static void frame_counter_force(void *ctx)
+{
+    if (s_fc && s_fc->pending && frame_counter_persist(s_fc->pending, s_fc->pending_length,
+                                                       s_fc->pending_counter) == EZB_ERR_NONE) {
+        s_fc->stats.forced++;
+    }
+}
+
+/* The stack writes the dataset at its own pace, the last skipped value is written once a quarter of the window is
+ * left, before the counter leaves the reserved window between two writes of the stack. */
+static void frame_counter_tx_done(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr,
+                                  const ezb_radio_frame_t *ack, ezb_err_t error)
+{
+    uint32_t used;
+
+    if (!s_fc->persisted_valid) {
+        return;
+    }
+    used = ezb_nwk_get_frame_counter() - s_fc->persisted_counter;
+    if (used >= s_fc->config.window) {
+        if (!s_fc->overrun) {
+            s_fc->overrun = true;
+            s_fc->stats.overruns++;
+        }
+        return;
+    }
+    s_fc->overrun = false;
+    if (used >= s_fc->config.window - s_fc->config.window / 4 && s_fc->pending &&
+        s_fc->pending_counter != s_fc->persisted_counter && !ezb_timer_is_armed(&s_fc_timer)) {
+        ezb_timer_start(&s_fc_timer, 0);
+    }
+}
+
+ezb_err_t ezb_nwk_frame_counter_window_init(const ezb_nwk_frame_counter_config_t *config)
+{
+    uint32_t counter;
+    ezb_err_t ret;
+
+    if (!config || config->window < 2) {
+        return EZB_ERR_INV_ARG;
+    }
+    /* The restored network is already joined at EZB_ZDO_SIGNAL_SKIP_STARTUP, what matters is that no frame has been
+     * secured with a counter the stored value may not reserve. */
+    if (s_fc || ezb_mac_radio_nwk_secured_sent()) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_fc = calloc(1, sizeof(frame_counter_ctx_t));
+    if (!s_fc) {
+        return EZB_ERR_NO_MEM;
+    }
+    if (!ezb_timer_init(&s_fc_timer, "zb_fcnt", frame_counter_force, NULL)) {
+        ret = EZB_ERR_NO_MEM;
+        goto error;
+    }
+    s_fc->config = *config;
+    s_fc->stats.window = config->window;
+
+    counter = ezb_nwk_get_frame_counter();
+    if (!ezb_bdb_is_factory_new()) {
+        ret = ezb_nwk_set_frame_counter(counter + config->window);
+        if (ret != EZB_ERR_NONE) {
+            ezb_timer_deinit(&s_fc_timer);
+            goto error;
+        }
+        s_fc->stats.boot_jump = config->window;
+        counter += config->window;
+    }
+    /* Nothing is stored for the new counter yet, the first write of the stack is always forwarded. */
+    s_fc->stats.reserved = counter;
+    s_fc->hook.tx_done = frame_counter_tx_done;
+    ezb_mac_radio_hook_register(&s_fc->hook);
+    return EZB_ERR_NONE;
+
+error:
+    free(s_fc);
+    s_fc = NULL;
+    return ret;
+}
+
+void ezb_nwk_frame_counter_window_deinit(void)
+{
+    if (!s_fc) {
+        return;
+    }
+    ezb_mac_radio_hook_unregister(&s_fc->hook);
+    ezb_timer_deinit(&s_fc_timer);
+    ezb_nwk_frame_counter_flush();
+    free(s_fc->pending);
+    free(s_fc);
+    s_fc = NULL;
+}
+
+ezb_err_t ezb_nwk_frame_counter_flush(void)
+{
+    if (!s_fc) {
+        return EZB_ERR_INV_STATE;
+    }
+    if (!s_fc->pending) {
+        return EZB_ERR_NONE;
+    }
+    return frame_counter_persist(s_fc->pending, s_fc->pending_length, s_fc->pending_counter);
+}
+
+void ezb_nwk_frame_counter_get_stats(ezb_nwk_frame_counter_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_fc) {
+        memset(stats, 0, sizeof(ezb_nwk_frame_counter_stats_t));
+        return;
+    }
+    *stats = s_fc->stats;
+}
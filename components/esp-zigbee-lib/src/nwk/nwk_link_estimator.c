@@ -0,0 +1,344 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/platform/alarm.h>
+#include <ezbee/test_utils.h>
+#include <ezbee/nwk/nwk_link_estimator.h>
+
+#include "mac/mac_radio_hook.h"
+#include "nwk/nwk_command.h"
+#include "utils/ezb_lru.h"
+#include "utils/ezb_timer.h"
+
+#define LINK_AVG_SHIFT       8      /* The averages are kept in Q8 */
+#define LINK_COST_MIN        1U
+#define LINK_COST_MAX        7U
+#define LINK_COST_FRAC_SHIFT 4      /* The estimated costs are computed in 1/16 of a cost unit */
+#define LINK_COST_HYSTERESIS 12     /* 3/4 of a cost unit */
+#define LINK_SMOOTHING_MAX   7U
+
+typedef struct link_entry_s {
+    ezb_shortaddr_t addr;
+    bool has_rx;
+    bool has_ack;
+    int32_t lqi_avg;
+    int32_t rssi_avg;
+    int32_t ack_avg;
+    uint8_t in_cost;
+    uint8_t out_cost;
+    uint8_t reported_cost;  /* The cost of the link to the neighbor in its last link status, 0 if none */
+    uint32_t last_seen;
+    uint32_t rx_frames;
+    uint32_t tx_frames;
+    uint32_t tx_acked;
+    uint32_t cost_changes;
+} link_entry_t;
+
+/* The route cost policy, see ezb_cert_set_route_cost_policy() */
+typedef struct link_cost_policy_s {
+    bool disable_in_out_cost_updating;
+    bool delay_pending_tx_on_rrep;
+    bool use_route_for_neighbor;
+} link_cost_policy_t;
+
+typedef struct link_estimator_ctx_s {
+    ezb_nwk_link_estimator_config_t config;
+    link_entry_t *entries;
+    ezb_mac_radio_hook_t hook;
+} link_estimator_ctx_t;
+
+static link_estimator_ctx_t *s_link;
+static ezb_timer_t s_link_timer;
+/* The policy last requested by the application, the stack starts with every option disabled */
+static link_cost_policy_t s_link_policy;
+
+extern ezb_err_t __real_ezb_cert_set_route_cost_policy(bool disable_in_out_cost_updating,
+                                                       bool delay_pending_tx_on_rrep, bool use_route_for_neighbor);
+
+static inline int32_t ewma_update(int32_t avg, int32_t sample, uint8_t shift, bool first)
+{
+    sample *= 1 << LINK_AVG_SHIFT;
+    return first ? sample : avg + (sample - avg) / (1 << shift);
+}
+
+static inline int32_t ewma_value(int32_t avg)
+{
+    return (avg + (1 << (LINK_AVG_SHIFT - 1))) >> LINK_AVG_SHIFT;
+}
+
+static bool link_entry_is_free(const void *entry)
+{
+    return ((const link_entry_t *)entry)->addr == EZB_NWK_ADDR_UNKNOWN;
+}
+
+static link_entry_t *link_find(ezb_shortaddr_t addr)
+{
+    for (uint16_t i = 0; i < s_link->config.max_neighbors; i++) {
+        if (s_link->entries[i].addr == addr) {
+            return &s_link->entries[i];
+        }
+    }
+    return NULL;
+}
+
+static link_entry_t *link_find_or_alloc(ezb_shortaddr_t addr, uint32_t now)
+{
+    link_entry_t *entry = link_find(addr);
+
+    if (!entry) {
+        entry = ezb_lru_select(s_link->entries, s_link->config.max_neighbors, sizeof(link_entry_t),
+                               offsetof(link_entry_t, last_seen), link_entry_is_free);
+        memset(entry, 0, sizeof(link_entry_t));
+        entry->addr = addr;
+    }
+    entry->last_seen = now;
+    return entry;
+}
+
+/* Zigbee specification 3.6.3.1: C{l} = min(7, round(1 / p^4)), with p the probability of delivery on the link
+ * taken here as value / 255. The result is in 1/16 of a cost unit. */
+static uint32_t link_cost_estimate(int32_t value)
+{
+    uint64_t p4;
+    uint64_t cost;
+
+    if (value <= 0) {
+        return LINK_COST_MAX << LINK_COST_FRAC_SHIFT;
+    }
+    value = value > UINT8_MAX ? UINT8_MAX : value;
+    p4 = (uint64_t)value * value * value * value;
+    cost = (((uint64_t)UINT8_MAX * UINT8_MAX * UINT8_MAX * UINT8_MAX) << LINK_COST_FRAC_SHIFT) / p4;
+    if (cost > (LINK_COST_MAX << LINK_COST_FRAC_SHIFT)) {
+        cost = LINK_COST_MAX << LINK_COST_FRAC_SHIFT;
+    }
+    return (uint32_t)cost;
+}
+
+static uint8_t link_cost_publish(uint8_t published, uint32_t estimate)
+{
+    int32_t delta = (int32_t)estimate - (int32_t)(published << LINK_COST_FRAC_SHIFT);
+    uint8_t cost;
+
+    if (published && delta < LINK_COST_HYSTERESIS && delta > -LINK_COST_HYSTERESIS) {
+        return published;
+    }
+    cost = (estimate + (1U << (LINK_COST_FRAC_SHIFT - 1))) >> LINK_COST_FRAC_SHIFT;
+    return cost < LINK_COST_MIN ? LINK_COST_MIN : cost;
+}
+
+static void link_radio_rx(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr)
+{
+    ezb_nwk_link_status_entry_t status;
+    link_entry_t *entry;
+
+    if (mhr->src.addr_mode != EZB_ADDR_MODE_SHORT || mhr->type == EZB_MAC_FRAME_TYPE_ACK) {
+        return;
+    }
+    entry = link_find_or_alloc(mhr->src.u.short_addr, ezb_plat_milli_alarm_get_now());
+    entry->lqi_avg = ewma_update(entry->lqi_avg, frame->info.rx.lqi, s_link->config.lqi_smoothing, !entry->has_rx);
+    entry->rssi_avg = ewma_update(entry->rssi_avg, frame->info.rx.rssi, s_link->config.lqi_smoothing, !entry->has_rx);
+    entry->has_rx = true;
+    entry->rx_frames++;
+    if (ezb_nwk_link_status_parse(mhr, ezb_nwk_get_short_address(), &status) && status.incoming_cost) {
+        entry->reported_cost = status.incoming_cost;
+    }
+}
+
+static void link_radio_tx_done(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr,
+                               const ezb_radio_frame_t *ack, ezb_err_t error)
+{
+    link_entry_t *entry;
+    bool acked;
+
+    if (!mhr->ack_request || mhr->dst.addr_mode != EZB_ADDR_MODE_SHORT) {
+        return;
+    }
+    /* A busy channel tells nothing about the link. */
+    if (error == EZB_ERR_NONE) {
+        acked = true;
+    } else if (error == EZB_ERR_MAC_NO_ACK) {
+        acked = false;
+    } else {
+        return;
+    }
+
+    entry = link_find_or_alloc(mhr->dst.u.short_addr, ezb_plat_milli_alarm_get_now());
+    entry->ack_avg = ewma_update(entry->ack_avg, acked ? UINT8_MAX : 0, s_link->config.ack_smoothing, !entry->has_ack);
+    entry->has_ack = true;
+    entry->tx_frames++;
+    entry->tx_acked += acked;
+}
+
+static void link_update_costs(void *ctx)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_neighbor_info_t nbr = {};
+
+    while (ezb_nwk_get_next_neighbor(&itor, &nbr) == EZB_ERR_NONE) {
+        link_entry_t *entry;
+        uint32_t in_estimate;
+        uint8_t in_cost, out_cost;
+
+        if (nbr.device_type != EZB_NWK_DEVICE_TYPE_COORDINATOR && nbr.device_type != EZB_NWK_DEVICE_TYPE_ROUTER) {
+            continue;
+        }
+        entry = link_find(nbr.short_addr);
+        if (!entry || !entry->has_rx) {
+            continue;
+        }
+
+        in_estimate = link_cost_estimate(ewma_value(entry->lqi_avg));
+        in_cost = link_cost_publish(entry->in_cost, in_estimate);
+        /* The outgoing cost is the one the neighbor measures and reports in its link status, the cost in the table
+         * is kept until the first one is received. */
+        out_cost = entry->reported_cost ? entry->reported_cost : nbr.outgoing_cost;
+        if (in_cost != entry->in_cost || out_cost != entry->out_cost) {
+            entry->cost_changes += entry->in_cost || entry->out_cost;
+        } else if (nbr.outgoing_cost == out_cost) {
+            continue;
+        }
+        if (ezb_nwk_set_neighbor_info(nbr.short_addr, nbr.age, out_cost, in_cost) == EZB_ERR_NONE) {
+            entry->in_cost = in_cost;
+            entry->out_cost = out_cost;
+        }
+    }
+
+    ezb_timer_start(&s_link_timer, (uint32_t)s_link->config.update_interval * 1000U);
+}
+
+static void link_entry_to_info(const link_entry_t *entry, ezb_nwk_link_info_t *info)
+{
+    info->short_addr = entry->addr;
+    info->lqi = entry->has_rx ? ewma_value(entry->lqi_avg) : 0;
+    info->rssi = entry->has_rx ? ewma_value(entry->rssi_avg) : EZB_RADIO_RSSI_INVALID;
+    info->ack_ratio = entry->has_ack ? ewma_value(entry->ack_avg) : 0;
+    info->incoming_cost = entry->in_cost;
+    info->outgoing_cost = entry->out_cost;
+    info->rx_frames = entry->rx_frames;
+    info->tx_frames = entry->tx_frames;
+    info->tx_acked = entry->tx_acked;
+    info->cost_changes = entry->cost_changes;
+}
+
+ezb_err_t ezb_nwk_link_estimator_init(const ezb_nwk_link_estimator_config_t *config)
+{
+    ezb_err_t ret = EZB_ERR_NONE;
+
+    if (!config || !config->max_neighbors || !config->update_interval ||
+        config->lqi_smoothing < 1 || config->lqi_smoothing > LINK_SMOOTHING_MAX ||
+        config->ack_smoothing < 1 || config->ack_smoothing > LINK_SMOOTHING_MAX) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_link) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_link = calloc(1, sizeof(link_estimator_ctx_t));
+    if (!s_link) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_link->entries = calloc(config->max_neighbors, sizeof(link_entry_t));
+    if (!s_link->entries || !ezb_timer_init(&s_link_timer, "zb_link", link_update_costs, NULL)) {
+        ret = EZB_ERR_NO_MEM;
+        goto exit;
+    }
+    for (uint16_t i = 0; i < config->max_neighbors; i++) {
+        s_link->entries[i].addr = EZB_NWK_ADDR_UNKNOWN;
+    }
+
+    /* The stack must not overwrite the published costs, the other options of the application are kept. */
+    ret = __real_ezb_cert_set_route_cost_policy(true, s_link_policy.delay_pending_tx_on_rrep,
+                                                s_link_policy.use_route_for_neighbor);
+    if (ret != EZB_ERR_NONE) {
+        ezb_timer_deinit(&s_link_timer);
+        goto exit;
+    }
+
+    s_link->config = *config;
+    s_link->hook.rx = link_radio_rx;
+    s_link->hook.tx_done = link_radio_tx_done;
+    ezb_mac_radio_hook_register(&s_link->hook);
+    ezb_timer_start(&s_link_timer, (uint32_t)config->update_interval * 1000U);
+
+exit:
+    if (ret != EZB_ERR_NONE) {
+        free(s_link->entries);
+        free(s_link);
+        s_link = NULL;
+    }
+    return ret;
+}
+
+void ezb_nwk_link_estimator_deinit(void)
+{
+    if (!s_link) {
+        return;
+    }
+    ezb_timer_deinit(&s_link_timer);
+    ezb_mac_radio_hook_unregister(&s_link->hook);
+    __real_ezb_cert_set_route_cost_policy(s_link_policy.disable_in_out_cost_updating,
+                                          s_link_policy.delay_pending_tx_on_rrep,
+                                          s_link_policy.use_route_for_neighbor);
+    free(s_link->entries);
+    free(s_link);
+    s_link = NULL;
+}
+
+ezb_err_t ezb_nwk_get_link_info(ezb_shortaddr_t short_addr, ezb_nwk_link_info_t *info)
+{
+    link_entry_t *entry;
+
+    if (!info || !s_link) {
+        return EZB_ERR_INV_ARG;
+    }
+    entry = link_find(short_addr);
+    if (!entry || short_addr == EZB_NWK_ADDR_UNKNOWN) {
+        return EZB_ERR_NOT_FOUND;
+    }
+    link_entry_to_info(entry, info);
+    return EZB_ERR_NONE;
+}
+
+ezb_err_t ezb_nwk_get_next_link_info(ezb_nwk_info_iterator_t *iterator, ezb_nwk_link_info_t *info)
+{
+    uintptr_t index;
+
+    if (!iterator || !info || !s_link) {
+        return EZB_ERR_INV_ARG;
+    }
+
+    /* The iterator holds the index of the next entry to visit, so EZB_NWK_INFO_ITERATOR_INIT starts at 0. */
+    for (index = (uintptr_t)*iterator; index < s_link->config.max_neighbors; index++) {
+        if (s_link->entries[index].addr != EZB_NWK_ADDR_UNKNOWN) {
+            link_entry_to_info(&s_link->entries[index], info);
+            *iterator = (ezb_nwk_info_iterator_t)(index + 1);
+            return EZB_ERR_NONE;
+        }
+    }
+    *iterator = EZB_NWK_INFO_ITERATOR_EOT;
+    return EZB_ERR_NOT_FOUND;
+}
+
+ezb_err_t __wrap_ezb_cert_set_route_cost_policy(bool disable_in_out_cost_updating, bool delay_pending_tx_on_rrep,
+                                                bool use_route_for_neighbor)
+{
+    ezb_err_t ret;
+
+    /* The link costs stay with the estimator while it runs, the policy of the application applies after it. */
+    ret = __real_ezb_cert_set_route_cost_policy(disable_in_out_cost_updating || s_link, delay_pending_tx_on_rrep,
+                                                use_route_for_neighbor);
+    if (ret == EZB_ERR_NONE) {
+        s_link_policy.disable_in_out_cost_updating = disable_in_out_cost_updating;
+        s_link_policy.delay_pending_tx_on_rrep = delay_pending_tx_on_rrep;
+        s_link_policy.use_route_for_neighbor = use_route_for_neighbor;
+    }
+    return ret;
+}
@@ -0,0 +1,304 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/app_signals.h>
+#include <ezbee/platform/alarm.h>
+#include <ezbee/test_utils.h>
+#include <ezbee/nwk/nwk_link_status.h>
+#include <ezbee/nwk/nwk_link_estimator.h>
+
+#include "mac/mac_radio_hook.h"
+#include "nwk/nwk_command.h"
+#include "utils/ezb_lru.h"
+#include "utils/ezb_timer.h"
+
+typedef struct link_status_neighbor_s {
+    ezb_shortaddr_t addr;
+    uint32_t last_heard;        /* Time of the last frame received from the neighbor */
+    uint32_t last_used;         /* Time of the last frame or of the last period the neighbor was in the table */
+    uint8_t in_cost;            /* The costs of the link reported by the neighbor in its last link status, 0 if none */
+    uint8_t out_cost;
+    bool heard;
+    bool listed;                /* A router neighbor in the neighbor table at the last period */
+    bool seen;                  /* A router neighbor in the neighbor table at this period */
+} link_status_neighbor_t;
+
+typedef struct link_status_ctx_s {
+    ezb_nwk_link_status_adaptive_config_t config;
+    ezb_nwk_link_status_stats_t stats;
+    link_status_neighbor_t *neighbors;
+    ezb_mac_radio_hook_t hook;
+    uint8_t saved_period;       /* The link status period before the adaptive mode was started */
+    uint8_t stable;             /* Number of periods without churn */
+    bool started;               /* The router neighbors of a first period are known */
+    bool churn;
+} link_status_ctx_t;
+
+static link_status_ctx_t *s_ls;
+static ezb_timer_t s_ls_timer;
+static ezb_timer_t s_ls_churn_timer;
+
+static bool is_router(const ezb_nwk_neighbor_info_t *nbr)
+{
+    return nbr->device_type == EZB_NWK_DEVICE_TYPE_COORDINATOR || nbr->device_type == EZB_NWK_DEVICE_TYPE_ROUTER;
+}
+
+static bool link_status_neighbor_is_free(const void *entry)
+{
+    return ((const link_status_neighbor_t *)entry)->addr == EZB_NWK_ADDR_UNKNOWN;
+}
+
+static link_status_neighbor_t *link_status_find(ezb_shortaddr_t addr, uint32_t now, bool alloc)
+{
+    link_status_neighbor_t *entry;
+
+    for (uint8_t i = 0; i < s_ls->config.max_neighbors; i++) {
+        if (s_ls->neighbors[i].addr == addr) {
+            s_ls->neighbors[i].last_used = now;
+            return &s_ls->neighbors[i];
+        }
+    }
+    if (!alloc) {
+        return NULL;
+    }
+    entry = ezb_lru_select(s_ls->neighbors, s_ls->config.max_neighbors, sizeof(link_status_neighbor_t),
+                           offsetof(link_status_neighbor_t, last_used), link_status_neighbor_is_free);
+    memset(entry, 0, sizeof(link_status_neighbor_t));
+    entry->addr = addr;
+    entry->last_used = now;
+    return entry;
+}
+
+static void link_status_set_period(uint8_t period)
+{
+    if (period != s_ls->stats.period && ezb_nwk_set_link_status_period(period) == EZB_ERR_NONE) {
+        s_ls->stats.period = period;
+        s_ls->stats.period_changes++;
+    }
+}
+
+static void link_status_churn(void)
+{
+    s_ls->churn = true;
+    s_ls->stats.churn_events++;
+    if (s_ls->stats.period != s_ls->config.min_period) {
+        link_status_set_period(s_ls->config.min_period);
+        ezb_timer_start(&s_ls_timer, (uint32_t)s_ls->stats.period * 1000U);
+    }
+}
+
+static void link_status_deferred_churn(void *ctx)
+{
+    link_status_churn();
+}
+
+static void link_status_radio_rx(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr)
+{
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+    ezb_nwk_link_status_entry_t ls;
+    link_status_neighbor_t *entry;
+    bool is_ls;
+
+    if (mhr->src.addr_mode != EZB_ADDR_MODE_SHORT || mhr->type != EZB_MAC_FRAME_TYPE_DATA) {
+        return;
+    }
+    /* Only the routers listing the device in their link status are tracked, any frame of them is heard. */
+    is_ls = ezb_nwk_link_status_parse(mhr, ezb_nwk_get_short_address(), &ls);
+    entry = link_status_find(mhr->src.u.short_addr, now, is_ls);
+    if (!entry) {
+        return;
+    }
+    entry->last_heard = now;
+    entry->heard = true;
+    if (!is_ls) {
+        return;
+    }
+
+    /* A cost the neighbor reports is not rewritten by the device, unlike the costs of the neighbor table. */
+    if (entry->in_cost && (ls.incoming_cost != entry->out_cost || ls.outgoing_cost != entry->in_cost) &&
+        !ezb_timer_is_armed(&s_ls_churn_timer)) {
+        ezb_timer_start(&s_ls_churn_timer, 0);
+    }
+    entry->out_cost = ls.incoming_cost;
+    entry->in_cost = ls.outgoing_cost;
+}
+
+/* Reset the age of a router neighbor heard within the longest period, a neighbor running a longer period than the
+ * device would otherwise be aged out between two of its link status. */
+static void link_status_refresh_age(const ezb_nwk_neighbor_info_t *nbr, const link_status_neighbor_t *entry,
+                                    uint32_t now)
+{
+    ezb_nwk_link_info_t link = {};
+    uint8_t in_cost = entry->in_cost;
+
+    if (!nbr->age || !entry->heard || now - entry->last_heard > (uint32_t)s_ls->config.max_period * 1000U) {
+        return;
+    }
+    if (ezb_nwk_get_link_info(nbr->short_addr, &link) == EZB_ERR_NONE && link.incoming_cost) {
+        in_cost = link.incoming_cost;
+    }
+    if (in_cost && ezb_nwk_set_neighbor_info(nbr->short_addr, 0, nbr->outgoing_cost, in_cost) == EZB_ERR_NONE) {
+        s_ls->stats.age_refreshes++;
+    }
+}
+
+static void link_status_tick(void *ctx)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_neighbor_info_t nbr = {};
+    uint32_t now = ezb_plat_milli_alarm_get_now();
+    bool appeared = false;
+
+    /* A router neighbor appearing is churn. One leaving the table is not: it aged out, or its leave or link failure
+     * has been signaled already. */
+    while (ezb_nwk_get_next_neighbor(&itor, &nbr) == EZB_ERR_NONE) {
+        link_status_neighbor_t *entry;
+
+        if (!is_router(&nbr)) {
+            continue;
+        }
+        entry = link_status_find(nbr.short_addr, now, true);
+        appeared |= !entry->listed;
+        entry->seen = true;
+        link_status_refresh_age(&nbr, entry, now);
+    }
+    for (uint8_t i = 0; i < s_ls->config.max_neighbors; i++) {
+        s_ls->neighbors[i].listed = s_ls->neighbors[i].seen;
+        s_ls->neighbors[i].seen = false;
+    }
+    if (s_ls->started && appeared) {
+        s_ls->churn = true;
+        s_ls->stats.churn_events++;
+    }
+    s_ls->started = true;
+
+    if (s_ls->churn) {
+        s_ls->stable = 0;
+        link_status_set_period(s_ls->config.min_period);
+    } else if (++s_ls->stable >= s_ls->config.stable_periods) {
+        uint32_t period = (uint32_t)s_ls->stats.period * 2;
+        s_ls->stable = 0;
+        link_status_set_period(period > s_ls->config.max_period ? s_ls->config.max_period : period);
+    }
+    s_ls->churn = false;
+    ezb_timer_start(&s_ls_timer, (uint32_t)s_ls->stats.period * 1000U);
+}
+
+static bool link_status_signal_handler(const ezb_app_signal_t *app_signal)
+{
+    ezb_app_signal_type_t type = ezb_app_signal_get_type(app_signal);
+
+    if (!s_ls) {
+        return false;
+    }
+
+    switch (type) {
+    case EZB_NWK_SIGNAL_DEVICE_ASSOCIATED:
+    case EZB_ZDO_SIGNAL_DEVICE_ANNCE:
+    case EZB_ZDO_SIGNAL_DEVICE_UPDATE:
+    case EZB_ZDO_SIGNAL_LEAVE_INDICATION:
+        link_status_churn();
+        break;
+    case EZB_NWK_SIGNAL_NETWORK_STATUS: {
+        const ezb_nwk_signal_network_status_params_t *params = ezb_app_signal_get_params(app_signal);
+        if (params->status == EZB_NWK_NETWORK_STATUS_LINK_FAILURE ||
+            params->status == EZB_NWK_NETWORK_STATUS_PARENT_LINK_FAILURE) {
+            link_status_churn();
+        }
+        break;
+    }
+    default:
+        break;
+    }
+
+    return false;
+}
+
+ezb_err_t ezb_nwk_link_status_adaptive_start(const ezb_nwk_link_status_adaptive_config_t *config)
+{
+    ezb_err_t ret = EZB_ERR_NONE;
+
+    if (!config || !config->min_period || config->max_period < config->min_period || !config->stable_periods ||
+        !config->max_neighbors) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_ls) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_ls = calloc(1, sizeof(link_status_ctx_t));
+    if (!s_ls) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_ls->neighbors = calloc(config->max_neighbors, sizeof(link_status_neighbor_t));
+    if (!s_ls->neighbors || !ezb_timer_init(&s_ls_timer, "zb_lsp", link_status_tick, NULL)) {
+        ret = EZB_ERR_NO_MEM;
+        goto exit;
+    }
+    if (!ezb_timer_init(&s_ls_churn_timer, "zb_lsc", link_status_deferred_churn, NULL)) {
+        ezb_timer_deinit(&s_ls_timer);
+        ret = EZB_ERR_NO_MEM;
+        goto exit;
+    }
+    for (uint8_t i = 0; i < config->max_neighbors; i++) {
+        s_ls->neighbors[i].addr = EZB_NWK_ADDR_UNKNOWN;
+    }
+    s_ls->config = *config;
+    s_ls->saved_period = ezb_nwk_get_link_status_period();
+    s_ls->stats.period = s_ls->saved_period;
+    ret = ezb_app_signal_add_handler(link_status_signal_handler);
+    if (ret != EZB_ERR_NONE) {
+        ezb_timer_deinit(&s_ls_churn_timer);
+        ezb_timer_deinit(&s_ls_timer);
+        goto exit;
+    }
+
+    s_ls->hook.rx = link_status_radio_rx;
+    ezb_mac_radio_hook_register(&s_ls->hook);
+    link_status_set_period(config->min_period);
+    ezb_timer_start(&s_ls_timer, (uint32_t)s_ls->stats.period * 1000U);
+
+exit:
+    if (ret != EZB_ERR_NONE) {
+        free(s_ls->neighbors);
+        free(s_ls);
+        s_ls = NULL;
+    }
+    return ret;
+}
+
+ezb_err_t ezb_nwk_link_status_adaptive_stop(void)
+{
+    if (!s_ls) {
+        return EZB_ERR_INV_STATE;
+    }
+    ezb_timer_deinit(&s_ls_timer);
+    ezb_timer_deinit(&s_ls_churn_timer);
+    ezb_mac_radio_hook_unregister(&s_ls->hook);
+    ezb_app_signal_remove_handler(link_status_signal_handler);
+    ezb_nwk_set_link_status_period(s_ls->saved_period);
+    free(s_ls->neighbors);
+    free(s_ls);
+    s_ls = NULL;
+    return EZB_ERR_NONE;
+}
+
+void ezb_nwk_link_status_get_stats(ezb_nwk_link_status_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_ls) {
+        memset(stats, 0, sizeof(ezb_nwk_link_status_stats_t));
+        stats->period = ezb_nwk_get_link_status_period();
+        return;
+    }
+    *stats = s_ls->stats;
+}
@@ -0,0 +1,251 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <ezbee/app_signals.h>
+#include <ezbee/nwk/nwk_replay.h>
+
+#include "mac/mac_radio_hook.h"
+#include "nwk/nwk_security.h"
+#include "utils/ezb_hash.h"
+#include "utils/ezb_stats.h"
+
+/* Number of slots probed from the home slot of an address. */
+#define REPLAY_MAX_PROBE        8U
+
+/* IEEE 802.15.4-2015, 7.5 MAC commands */
+#define MAC_CMD_ASSOCIATION_REQUEST 0x01U
+
+typedef struct replay_entry_s {
+    uint64_t addr;      /* 0 if the entry is free */
+    uint32_t counter;
+    uint32_t stamp;     /* Access time, in ticks of s_replay->clock */
+    uint8_t key_seq;
+} replay_entry_t;
+
+typedef struct replay_ctx_s {
+    ezb_nwk_replay_table_stats_t stats;
+    replay_entry_t *entries;
+    ezb_mac_radio_hook_t hook;
+    uint32_t clock;
+} replay_ctx_t;
+
+static replay_ctx_t *s_replay;
+
+static inline uint16_t replay_home(uint64_t addr)
+{
+    return (uint16_t)(ezb_hash_mix64(addr) % s_replay->stats.size);
+}
+
+static inline uint8_t replay_probe_count(void)
+{
+    return s_replay->stats.size < REPLAY_MAX_PROBE ? s_replay->stats.size : REPLAY_MAX_PROBE;
+}
+
+static replay_entry_t *replay_lookup(uint64_t addr)
+{
+    uint16_t slot = replay_home(addr);
+
+    for (uint8_t i = 0; i < replay_probe_count(); i++) {
+        if (s_replay->entries[slot].addr == addr) {
+            return &s_replay->entries[slot];
+        }
+        slot = (slot + 1) % s_replay->stats.size;
+    }
+    return NULL;
+}
+
+/* A free slot in the probe window of the address, or the least recently used one. */
+static replay_entry_t *replay_insert(uint64_t addr)
+{
+    uint16_t slot = replay_home(addr);
+    replay_entry_t *victim = NULL;
+
+    for (uint8_t i = 0; i < replay_probe_count(); i++) {
+        replay_entry_t *entry = &s_replay->entries[slot];
+        if (!entry->addr) {
+            victim = entry;
+            break;
+        }
+        if (!victim || (int32_t)(entry->stamp - victim->stamp) < 0) {
+            victim = entry;
+        }
+        slot = (slot + 1) % s_replay->stats.size;
+    }
+    if (victim->addr) {
+        s_replay->stats.evictions++;
+    } else {
+        s_replay->stats.used++;
+    }
+    victim->addr = addr;
+    return victim;
+}
+
+static void replay_remove(uint64_t addr)
+{
+    replay_entry_t *entry = replay_lookup(addr);
+
+    if (entry) {
+        entry->addr = 0;
+        s_replay->stats.used--;
+    }
+}
+
+static ezb_err_t replay_verify(const ezb_nwk_security_t *sec)
+{
+    uint8_t plain[EZB_NWK_SECURITY_MAX_PAYLOAD];
+    uint8_t plain_len;
+
+    return ezb_nwk_security_decrypt(sec, plain, &plain_len);
+}
+
+static bool replay_radio_rx_filter(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr)
+{
+    ezb_nwk_security_t sec;
+    replay_entry_t *entry;
+    ezb_err_t ret;
+
+    /* A device associating again may have been reset, along with its frame counter. */
+    if (mhr->type == EZB_MAC_FRAME_TYPE_COMMAND && mhr->payload_len &&
+        mhr->payload[0] == MAC_CMD_ASSOCIATION_REQUEST && mhr->src.addr_mode == EZB_ADDR_MODE_EXT) {
+        replay_remove(mhr->src.u.extended_addr.u64);
+        return true;
+    }
+    if (!ezb_nwk_security_parse(mhr, &sec) || !sec.source.u64) {
+        return true;
+    }
+
+    s_replay->stats.frames++;
+    entry = replay_lookup(sec.source.u64);
+    if (entry && entry->key_seq == sec.key_seq && sec.frame_counter <= entry->counter) {
+        s_replay->stats.replays++;
+        if (ezb_nwk_stats_is_enabled()) {
+            EZB_STATS_INC(nwk.frame_counter_failures);
+        }
+        return false;
+    }
+    ret = replay_verify(&sec);
+    if (ret != EZB_ERR_NONE) {
+        /* A frame under a key that cannot be checked yet, e.g. during a key switch, is not a decrypt failure. */
+        s_replay->stats.unverified++;
+        if (ret == EZB_ERR_SECURITY && ezb_nwk_stats_is_enabled()) {
+            EZB_STATS_INC(nwk.decrypt_failures);
+        }
+        return true;
+    }
+    if (!entry) {
+        entry = replay_insert(sec.source.u64);
+    }
+    entry->counter = sec.frame_counter;
+    entry->key_seq = sec.key_seq;
+    entry->stamp = ++s_replay->clock;
+    s_replay->stats.updates++;
+    return true;
+}
+
+static bool replay_signal_handler(const ezb_app_signal_t *app_signal)
+{
+    if (!s_replay) {
+        return false;
+    }
+
+    switch (ezb_app_signal_get_type(app_signal)) {
+    case EZB_ZDO_SIGNAL_DEVICE_ANNCE: {
+        const ezb_zdo_signal_device_annce_params_t *params = ezb_app_signal_get_params(app_signal);
+        replay_remove(params->device_addr.u64);
+        break;
+    }
+    case EZB_ZDO_SIGNAL_LEAVE_INDICATION: {
+        const ezb_zdo_signal_leave_indication_params_t *params = ezb_app_signal_get_params(app_signal);
+        replay_remove(params->device_addr.u64);
+        break;
+    }
+    case EZB_ZDO_SIGNAL_DEVICE_UPDATE: {
+        const ezb_zdo_signal_device_update_params_t *params = ezb_app_signal_get_params(app_signal);
+        replay_remove(params->device_addr.u64);
+        break;
+    }
+    default:
+        break;
+    }
+
+    return false;
+}
+
+ezb_err_t ezb_nwk_replay_table_init(const ezb_nwk_replay_table_config_t *config)
+{
+    ezb_err_t ret;
+
+    if (!config || !config->size) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (s_replay) {
+        return EZB_ERR_INV_STATE;
+    }
+
+    s_replay = calloc(1, sizeof(replay_ctx_t));
+    if (!s_replay) {
+        return EZB_ERR_NO_MEM;
+    }
+    s_replay->entries = calloc(config->size, sizeof(replay_entry_t));
+    if (!s_replay->entries) {
+        ret = EZB_ERR_NO_MEM;
+        goto exit;
+    }
+    s_replay->stats.size = config->size;
+    ret = ezb_app_signal_add_handler(replay_signal_handler);
+    if (ret != EZB_ERR_NONE) {
+        goto exit;
+    }
+    s_replay->hook.rx_filter = replay_radio_rx_filter;
+    ezb_mac_radio_hook_register(&s_replay->hook);
+
+exit:
+    if (ret != EZB_ERR_NONE) {
+        free(s_replay->entries);
+        free(s_replay);
+        s_replay = NULL;
+    }
+    return ret;
+}
+
+void ezb_nwk_replay_table_deinit(void)
+{
+    if (!s_replay) {
+        return;
+    }
+    ezb_mac_radio_hook_unregister(&s_replay->hook);
+    ezb_app_signal_remove_handler(replay_signal_handler);
+    free(s_replay->entries);
+    free(s_replay);
+    s_replay = NULL;
+}
+
+ezb_err_t ezb_nwk_replay_table_remove(const ezb_extaddr_t *ieee_addr)
+{
+    if (!ieee_addr) {
+        return EZB_ERR_INV_ARG;
+    }
+    if (!s_replay || !replay_lookup(ieee_addr->u64)) {
+        return EZB_ERR_NOT_FOUND;
+    }
+    replay_remove(ieee_addr->u64);
+    return EZB_ERR_NONE;
+}
+
+void ezb_nwk_replay_table_get_stats(ezb_nwk_replay_table_stats_t *stats)
+{
+    if (!stats) {
+        return;
+    }
+    if (!s_replay) {
+        memset(stats, 0, sizeof(ezb_nwk_replay_table_stats_t));
+        return;
+    }
+    *stats = s_replay->stats;
+}
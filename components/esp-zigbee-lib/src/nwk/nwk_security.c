@@ -0,0 +1,142 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <ezbee/secur.h>
+
+#include "nwk/nwk_security.h"
+#include "utils/ezb_ccm.h"
+
+/* Zigbee specification 4.5.1.1.1, the security level field of the security control */
+#define NWK_SEC_LEVEL_MASK 0x07U
+
+typedef struct nwk_security_key_s {
+    uint8_t key[EZB_CCM_KEY_SIZE];
+    uint8_t seq;
+    bool has_key;
+    bool has_seq;               /* The sequence number is learnt from the first frame authenticated with the key */
+} nwk_security_key_t;
+
+/* The last frame decrypted, the radio hooks of a frame share its plaintext instead of decrypting it again. */
+typedef struct nwk_security_memo_s {
+    uint8_t frame[EZB_NWK_SECURITY_MAX_PAYLOAD + UINT8_MAX]; /* The header, then the payload of the frame */
+    uint8_t header_len;
+    uint8_t payload_len;
+    uint8_t plain[EZB_NWK_SECURITY_MAX_PAYLOAD];
+    uint8_t plain_len;
+    ezb_err_t ret;
+    bool valid;
+} nwk_security_memo_t;
+
+/* The current network key, then the previous one */
+static nwk_security_key_t s_nwk_keys[2];
+static nwk_security_memo_t s_nwk_memo;
+
+/* Track the current network key of the stack, the previous key is kept after a switch. */
+static bool nwk_security_refresh_keys(void)
+{
+    uint8_t key[EZB_CCM_KEY_SIZE];
+
+    if (ezb_secur_get_network_key(key) != EZB_ERR_NONE) {
+        return false;
+    }
+    if (!s_nwk_keys[0].has_key || memcmp(key, s_nwk_keys[0].key, sizeof(key))) {
+        if (s_nwk_keys[0].has_key) {
+            s_nwk_keys[1] = s_nwk_keys[0];
+        }
+        memcpy(s_nwk_keys[0].key, key, sizeof(key));
+        s_nwk_keys[0].has_key = true;
+        s_nwk_keys[0].has_seq = false;
+    }
+    return true;
+}
+
+static bool nwk_security_ccm(const ezb_nwk_security_t *sec, const uint8_t *key, uint8_t level, uint8_t mic_len,
+                             uint8_t *plain, uint8_t *plain_len)
+{
+    uint8_t nonce[EZB_CCM_NONCE_SIZE];
+    uint8_t aad[UINT8_MAX];
+
+    /* The security level is sent as zero, the nonce and the authenticated data use the actual level. */
+    memcpy(nonce, sec->source.u8, 8);
+    memcpy(nonce + 8, sec->header + sec->control_offset + 1, 4);
+    nonce[12] = (sec->control & ~NWK_SEC_LEVEL_MASK) | level;
+    memcpy(aad, sec->header, sec->header_len);
+    aad[sec->control_offset] = nonce[12];
+
+    *plain_len = sec->payload_len - mic_len;
+    return ezb_ccm_decrypt(key, nonce, aad, sec->header_len, sec->payload, *plain_len, sec->payload + *plain_len,
+                           mic_len, plain);
+}
+
+/* The whole frame is compared, the source and the frame counter alone could be forged. */
+static bool nwk_security_memo_match(const ezb_nwk_security_t *sec)
+{
+    return s_nwk_memo.valid && s_nwk_memo.header_len == sec->header_len &&
+           s_nwk_memo.payload_len == sec->payload_len &&
+           !memcmp(s_nwk_memo.frame, sec->header, sec->header_len) &&
+           !memcmp(s_nwk_memo.frame + sec->header_len, sec->payload, sec->payload_len);
+}
+
+static void nwk_security_memo_store(const ezb_nwk_security_t *sec, ezb_err_t ret, const uint8_t *plain,
+                                    uint8_t plain_len)
+{
+    s_nwk_memo.valid = sec->payload_len <= EZB_NWK_SECURITY_MAX_PAYLOAD;
+    if (!s_nwk_memo.valid) {
+        return;
+    }
+    memcpy(s_nwk_memo.frame, sec->header, sec->header_len);
+    memcpy(s_nwk_memo.frame + sec->header_len, sec->payload, sec->payload_len);
+    s_nwk_memo.header_len = sec->header_len;
+    s_nwk_memo.payload_len = sec->payload_len;
+    s_nwk_memo.ret = ret;
+    s_nwk_memo.plain_len = ret == EZB_ERR_NONE ? plain_len : 0;
+    memcpy(s_nwk_memo.plain, plain, s_nwk_memo.plain_len);
+}
+
+static ezb_err_t nwk_security_decrypt(const ezb_nwk_security_t *sec, uint8_t *plain, uint8_t *plain_len)
+{
+    static const uint8_t mic_size[] = {0, 4, 8, 16, 0, 4, 8, 16};
+    uint8_t level = ezb_secur_get_security_level() & NWK_SEC_LEVEL_MASK;
+    uint8_t mic_len = mic_size[level];
+    nwk_security_key_t *current = &s_nwk_keys[0];
+    nwk_security_key_t *previous = &s_nwk_keys[1];
+
+    /* Only the levels with encryption are used by Zigbee PRO. */
+    if (level < EZB_SECUR_SECLEVEL_ENC_MIC32 || sec->payload_len < mic_len || !nwk_security_refresh_keys()) {
+        return EZB_ERR_NOT_FOUND;
+    }
+
+    if (current->has_seq && current->seq == sec->key_seq) {
+        return nwk_security_ccm(sec, current->key, level, mic_len, plain, plain_len) ? EZB_ERR_NONE : EZB_ERR_SECURITY;
+    }
+    if (previous->has_key && previous->has_seq && previous->seq == sec->key_seq) {
+        return nwk_security_ccm(sec, previous->key, level, mic_len, plain, plain_len) ? EZB_ERR_NONE : EZB_ERR_SECURITY;
+    }
+    /* Until a frame is authenticated with the current key, a failure tells nothing about the frame. */
+    if (!current->has_seq && nwk_security_ccm(sec, current->key, level, mic_len, plain, plain_len)) {
+        current->seq = sec->key_seq;
+        current->has_seq = true;
+        return EZB_ERR_NONE;
+    }
+    return EZB_ERR_NOT_FOUND;
+}
+
+ezb_err_t ezb_nwk_security_decrypt(const ezb_nwk_security_t *sec, uint8_t *plain, uint8_t *plain_len)
+{
+    ezb_err_t ret;
+
+    if (nwk_security_memo_match(sec)) {
+        *plain_len = s_nwk_memo.plain_len;
+        memcpy(plain, s_nwk_memo.plain, s_nwk_memo.plain_len);
+        return s_nwk_memo.ret;
+    }
+    *plain_len = 0;
+    ret = nwk_security_decrypt(sec, plain, plain_len);
+    nwk_security_memo_store(sec, ret, plain, *plain_len);
+    return ret;
+}
@@ -0,0 +1,46 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <ezbee/error.h>
+
+#include "mac/mac_frame.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Large enough for the payload of any NWK frame. */
+#define EZB_NWK_SECURITY_MAX_PAYLOAD 127U
+
+/**
+ * @brief Decrypt the payload of a secured NWK frame and check its MIC.
+ *
+ * The key is chosen by the key sequence number of the frame. The stack only exposes its current network key, so the
+ * sequence number of the current key is learnt from the first frame it authenticates, and the previous key is kept
+ * with its sequence number after a key switch. A frame under an alternate key that is not active yet cannot be
+ * checked.
+ *
+ * The result of the last frame is kept, so that the radio hooks handling the same frame decrypt it only once.
+ *
+ * @param[in]  sec       The auxiliary security header, see ezb_nwk_security_parse().
+ * @param[out] plain     The decrypted payload, of up to EZB_NWK_SECURITY_MAX_PAYLOAD bytes.
+ * @param[out] plain_len The length of the decrypted payload.
+ *
+ * @return
+ *      - EZB_ERR_NONE: The frame is authentic
+ *      - EZB_ERR_SECURITY: The MIC is invalid under the key of the sequence number of the frame
+ *      - EZB_ERR_NOT_FOUND: No key is known for the sequence number of the frame, or the frame is not encrypted
+ */
+ezb_err_t ezb_nwk_security_decrypt(const ezb_nwk_security_t *sec, uint8_t *plain, uint8_t *plain_len);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
@@ -0,0 +1,59 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include <ezbee/nwk/nwk_stats.h>
+
+#include "mac/mac_radio_hook.h"
+#include "utils/ezb_stats.h"
+
+static void nwk_stats_radio_tx_done(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr,
+                                    const ezb_radio_frame_t *ack, ezb_err_t error)
+{
+    ezb_nwk_frame_t nwk;
+
+    /* Count each relayed frame once, on its first successful transmission to the next hop. */
+    if (error != EZB_ERR_NONE || mhr->type != EZB_MAC_FRAME_TYPE_DATA || !ezb_nwk_frame_parse(mhr, &nwk)) {
+        return;
+    }
+    if (!EZB_NWK_IS_BROADCAST_ADDR(nwk.dst) && nwk.src != ezb_nwk_get_short_address()) {
+        EZB_STATS_INC(nwk.relayed_ucast);
+    }
+}
+
+static ezb_mac_radio_hook_t s_nwk_stats_hook = {
+    .tx_done = nwk_stats_radio_tx_done,
+};
+
+static bool s_nwk_stats_enabled;
+
+bool ezb_nwk_stats_is_enabled(void)
+{
+    return s_nwk_stats_enabled;
+}
+
+void ezb_nwk_stats_enable(bool enable)
+{
+    s_nwk_stats_enabled = enable;
+    if (enable) {
+        ezb_mac_radio_hook_register(&s_nwk_stats_hook);
+    } else {
+        ezb_mac_radio_hook_unregister(&s_nwk_stats_hook);
+    }
+}
+
+void ezb_nwk_get_stats(ezb_nwk_stats_t *stats)
+{
+    if (stats) {
+        *stats = g_ezb_stats.nwk;
+    }
+}
+
+void ezb_nwk_reset_stats(void)
+{
+    memset(&g_ezb_stats.nwk, 0, sizeof(ezb_nwk_stats_t));
+}
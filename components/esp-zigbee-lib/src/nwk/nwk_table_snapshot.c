@@ -0,0 +1,293 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include <ezbee/app_signals.h>
+#include <ezbee/nwk.h>
+#include <ezbee/platform/alarm.h>
+
+#include "mac/mac_radio_hook.h"
+#include "utils/ezb_hash.h"
+
+/* The stack also ages the entries out on its own timers, without any frame or signal, so a cached generation is
+ * checked against the table at least this often. */
+#define TABLE_VERSION_MAX_AGE_MS 15000U
+
+/* Digest of the topology fields seen by the last walk, and the generation derived from it. */
+typedef struct nwk_table_version_s {
+    uint32_t digest;
+    uint32_t generation;
+    uint32_t walk_time;
+    bool     valid;
+    bool     dirty;     /* An event that may change the table occurred since the last walk */
+} nwk_table_version_t;
+
+static nwk_table_version_t s_neighbor_version;
+static nwk_table_version_t s_route_version;
+static nwk_table_version_t s_route_record_version;
+static ezb_mac_radio_hook_t s_table_hook;
+static bool s_table_events;     /* The events are observed, the cached generations can be trusted */
+
+static void table_mark_dirty(bool routes)
+{
+    s_neighbor_version.dirty = true;
+    if (routes) {
+        s_route_version.dirty = true;
+        s_route_record_version.dirty = true;
+    }
+}
+
+/* The tables change on NWK commands (link status, route discovery, route record, leave, rejoin) and on MAC beacons
+ * and commands (association, data request of the children), sent or received. */
+static void table_radio_event(const ezb_mac_frame_t *mhr)
+{
+    ezb_nwk_frame_t nwk;
+
+    if (mhr->type == EZB_MAC_FRAME_TYPE_BEACON || mhr->type == EZB_MAC_FRAME_TYPE_COMMAND) {
+        table_mark_dirty(false);
+    } else if (mhr->type == EZB_MAC_FRAME_TYPE_DATA && ezb_nwk_frame_parse(mhr, &nwk) &&
+               nwk.type == EZB_NWK_FRAME_TYPE_COMMAND) {
+        table_mark_dirty(true);
+    }
+}
+
+static void table_radio_rx(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr)
+{
+    table_radio_event(mhr);
+}
+
+static void table_radio_tx_done(const ezb_radio_frame_t *frame, const ezb_mac_frame_t *mhr,
+                                const ezb_radio_frame_t *ack, ezb_err_t error)
+{
+    table_radio_event(mhr);
+}
+
+/* Joins, leaves, device announcements and network status reports. */
+static bool table_signal_handler(const ezb_app_signal_t *app_signal)
+{
+    table_mark_dirty(true);
+    return false;
+}
+
+/* The events are observed from the first query on, until then every query walks its table. */
+static void table_events_start(void)
+{
+    if (s_table_events) {
+        return;
+    }
+    if (ezb_app_signal_add_handler(table_signal_handler) != EZB_ERR_NONE) {
+        return;
+    }
+    s_table_hook.rx = table_radio_rx;
+    s_table_hook.tx_done = table_radio_tx_done;
+    ezb_mac_radio_hook_register(&s_table_hook);
+    s_table_events = true;
+}
+
+static bool table_version_is_current(const nwk_table_version_t *version)
+{
+    return s_table_events && version->valid && !version->dirty &&
+           ezb_plat_milli_alarm_get_now() - version->walk_time < TABLE_VERSION_MAX_AGE_MS;
+}
+
+static uint32_t neighbor_digest(uint32_t hash, const ezb_nwk_neighbor_info_t *nbr)
+{
+    hash = ezb_fnv1a_update(hash, &nbr->ieee_addr, sizeof(nbr->ieee_addr));
+    hash = ezb_fnv1a_update(hash, &nbr->short_addr, sizeof(nbr->short_addr));
+    hash = ezb_fnv1a_update(hash, &nbr->device_type, sizeof(nbr->device_type));
+    hash = ezb_fnv1a_update(hash, &nbr->depth, sizeof(nbr->depth));
+    hash = ezb_fnv1a_update(hash, &nbr->rx_on_when_idle, sizeof(nbr->rx_on_when_idle));
+    hash = ezb_fnv1a_update(hash, &nbr->relationship, sizeof(nbr->relationship));
+    return hash;
+}
+
+static uint32_t route_digest(uint32_t hash, const ezb_nwk_route_info_t *route)
+{
+    /* Only the defined flags, the reserved and deprecated bits are left out. */
+    uint8_t flags = route->flags.status | (route->flags.no_route_cache << 3) | (route->flags.many_to_one << 4) |
+                    (route->flags.route_record_required << 5);
+
+    hash = ezb_fnv1a_update(hash, &route->dest_addr, sizeof(route->dest_addr));
+    hash = ezb_fnv1a_update(hash, &route->next_hop_addr, sizeof(route->next_hop_addr));
+    hash = ezb_fnv1a_update(hash, &flags, sizeof(flags));
+    return hash;
+}
+
+static uint32_t route_record_digest(uint32_t hash, const ezb_nwk_route_record_info_t *rrec)
+{
+    uint8_t relay_count = rrec->relay_count > EZB_NWK_MAX_SOURCE_ROUTE ? EZB_NWK_MAX_SOURCE_ROUTE : rrec->relay_count;
+
+    hash = ezb_fnv1a_update(hash, &rrec->dest_address, sizeof(rrec->dest_address));
+    hash = ezb_fnv1a_update(hash, &rrec->relay_count, sizeof(rrec->relay_count));
+    hash = ezb_fnv1a_update(hash, rrec->path, relay_count * sizeof(rrec->path[0]));
+    return hash;
+}
+
+static uint32_t table_version_update(nwk_table_version_t *version, uint32_t digest)
+{
+    table_events_start();
+    /* The walk runs in the Zigbee task, no event can occur during it. */
+    version->dirty = false;
+    version->walk_time = ezb_plat_milli_alarm_get_now();
+    if (!version->valid || version->digest != digest) {
+        version->digest = digest;
+        version->valid = true;
+        version->generation++;
+    }
+    return version->generation;
+}
+
+ezb_err_t ezb_nwk_get_neighbor_table(ezb_nwk_neighbor_info_t *table, uint16_t *count, uint32_t *generation)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_neighbor_info_t overflow = {};
+    uint32_t digest = EZB_FNV1A_OFFSET_BASIS;
+    uint16_t capacity;
+    uint16_t copied = 0;
+    bool truncated = false;
+
+    if (!count || (!table && *count)) {
+        return EZB_ERR_INV_ARG;
+    }
+
+    capacity = *count;
+    while (true) {
+        ezb_nwk_neighbor_info_t *entry = copied < capacity ? &table[copied] : &overflow;
+        if (ezb_nwk_get_next_neighbor(&itor, entry) != EZB_ERR_NONE) {
+            break;
+        }
+        digest = neighbor_digest(digest, entry);
+        if (entry == &overflow) {
+            truncated = true;
+        } else {
+            copied++;
+        }
+    }
+
+    *count = copied;
+    uint32_t gen = table_version_update(&s_neighbor_version, digest);
+    if (generation) {
+        *generation = gen;
+    }
+    return truncated ? EZB_ERR_INV_SIZE : EZB_ERR_NONE;
+}
+
+ezb_err_t ezb_nwk_get_route_table(ezb_nwk_route_info_t *table, uint16_t *count, uint32_t *generation)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_route_info_t overflow = {};
+    uint32_t digest = EZB_FNV1A_OFFSET_BASIS;
+    uint16_t capacity;
+    uint16_t copied = 0;
+    bool truncated = false;
+
+    if (!count || (!table && *count)) {
+        return EZB_ERR_INV_ARG;
+    }
+
+    capacity = *count;
+    while (true) {
+        ezb_nwk_route_info_t *entry = copied < capacity ? &table[copied] : &overflow;
+        if (ezb_nwk_get_next_route(&itor, entry) != EZB_ERR_NONE) {
+            break;
+        }
+        digest = route_digest(digest, entry);
+        if (entry == &overflow) {
+            truncated = true;
+        } else {
+            copied++;
+        }
+    }
+
+    *count = copied;
+    uint32_t gen = table_version_update(&s_route_version, digest);
+    if (generation) {
+        *generation = gen;
+    }
+    return truncated ? EZB_ERR_INV_SIZE : EZB_ERR_NONE;
+}
+
+ezb_err_t ezb_nwk_get_route_record_table(ezb_nwk_route_record_info_t *table, uint16_t *count, uint32_t *generation)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_route_record_info_t overflow = {};
+    uint32_t digest = EZB_FNV1A_OFFSET_BASIS;
+    uint16_t capacity;
+    uint16_t copied = 0;
+    bool truncated = false;
+
+    if (!count || (!table && *count)) {
+        return EZB_ERR_INV_ARG;
+    }
+
+    capacity = *count;
+    while (true) {
+        ezb_nwk_route_record_info_t *entry = copied < capacity ? &table[copied] : &overflow;
+        if (ezb_nwk_get_next_route_record(&itor, entry) != EZB_ERR_NONE) {
+            break;
+        }
+        digest = route_record_digest(digest, entry);
+        if (entry == &overflow) {
+            truncated = true;
+        } else {
+            copied++;
+        }
+    }
+
+    *count = copied;
+    uint32_t gen = table_version_update(&s_route_record_version, digest);
+    if (generation) {
+        *generation = gen;
+    }
+    return truncated ? EZB_ERR_INV_SIZE : EZB_ERR_NONE;
+}
+
+uint32_t ezb_nwk_get_neighbor_table_generation(void)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_neighbor_info_t entry = {};
+    uint32_t digest = EZB_FNV1A_OFFSET_BASIS;
+
+    if (table_version_is_current(&s_neighbor_version)) {
+        return s_neighbor_version.generation;
+    }
+    while (ezb_nwk_get_next_neighbor(&itor, &entry) == EZB_ERR_NONE) {
+        digest = neighbor_digest(digest, &entry);
+    }
+    return table_version_update(&s_neighbor_version, digest);
+}
+
+uint32_t ezb_nwk_get_route_table_generation(void)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_route_info_t entry = {};
+    uint32_t digest = EZB_FNV1A_OFFSET_BASIS;
+
+    if (table_version_is_current(&s_route_version)) {
+        return s_route_version.generation;
+    }
+    while (ezb_nwk_get_next_route(&itor, &entry) == EZB_ERR_NONE) {
+        digest = route_digest(digest, &entry);
+    }
+    return table_version_update(&s_route_version, digest);
+}
+
+uint32_t ezb_nwk_get_route_record_table_generation(void)
+{
+    ezb_nwk_info_iterator_t itor = EZB_NWK_INFO_ITERATOR_INIT;
+    ezb_nwk_route_record_info_t entry = {};
+    uint32_t digest = EZB_FNV1A_OFFSET_BASIS;
+
+    if (table_version_is_current(&s_route_record_version)) {
+        return s_route_record_version.generation;
+    }
+    while (ezb_nwk_get_next_route_record(&itor, &entry) == EZB_ERR_NONE) {
+        digest = route_record_digest(digest, &entry);
+    }
+    return table_version_update(&s_route_record_version, digest);
+}
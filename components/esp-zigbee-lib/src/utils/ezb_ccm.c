@@ -0,0 +1,65 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include "mbedtls/version.h"
+
+#if (MBEDTLS_VERSION_NUMBER < 0x04000000)
+#include "mbedtls/ccm.h"
+#else
+#include "psa/crypto.h"
+#endif
+
+#include "utils/ezb_ccm.h"
+
+/* Large enough for the payload of any IEEE 802.15.4 frame. */
+#define CCM_MAX_DATA_SIZE 127U
+
+bool ezb_ccm_decrypt(const uint8_t *key, const uint8_t *nonce, const uint8_t *aad, size_t aad_len,
+                     const uint8_t *data, size_t data_len, const uint8_t *mic, uint8_t mic_len, uint8_t *plain)
+{
+    bool valid;
+
+    if (data_len > CCM_MAX_DATA_SIZE) {
+        return false;
+    }
+
+#if (MBEDTLS_VERSION_NUMBER < 0x04000000)
+    mbedtls_ccm_context ctx;
+
+    mbedtls_ccm_init(&ctx);
+    valid = mbedtls_ccm_setkey(&ctx, MBEDTLS_CIPHER_ID_AES, key, EZB_CCM_KEY_SIZE * 8) == 0 &&
+            mbedtls_ccm_auth_decrypt(&ctx, data_len, nonce, EZB_CCM_NONCE_SIZE, aad, aad_len, data, plain, mic,
+                                     mic_len) == 0;
+    mbedtls_ccm_free(&ctx);
+#else
+    psa_key_attributes_t attr = PSA_KEY_ATTRIBUTES_INIT;
+    psa_algorithm_t alg = PSA_ALG_AEAD_WITH_SHORTENED_TAG(PSA_ALG_CCM, mic_len);
+    uint8_t input[CCM_MAX_DATA_SIZE + 16];
+    psa_key_id_t key_id;
+    size_t plain_len;
+
+    if (mic_len > 16) {
+        return false;
+    }
+    psa_set_key_usage_flags(&attr, PSA_KEY_USAGE_DECRYPT);
+    psa_set_key_algorithm(&attr, alg);
+    psa_set_key_type(&attr, PSA_KEY_TYPE_AES);
+    psa_set_key_bits(&attr, EZB_CCM_KEY_SIZE * 8);
+    if (psa_import_key(&attr, key, EZB_CCM_KEY_SIZE, &key_id) != PSA_SUCCESS) {
+        return false;
+    }
+    /* PSA takes the tag appended to the ciphertext. */
+    memcpy(input, data, data_len);
+    memcpy(input + data_len, mic, mic_len);
+    valid = psa_aead_decrypt(key_id, alg, nonce, EZB_CCM_NONCE_SIZE, aad, aad_len, input, data_len + mic_len, plain,
+                             CCM_MAX_DATA_SIZE, &plain_len) == PSA_SUCCESS;
+    psa_destroy_key(key_id);
+#endif
+
+    return valid;
+}
@@ -0,0 +1,33 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ezbee/core_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EZB_CCM_NONCE_SIZE 13U
+
+/**
+ * @brief Decrypt an AES-128 CCM* frame with encryption and check its MIC.
+ *
+ * @param[out] plain The decrypted data, of @p data_len bytes.
+ *
+ * @return true if the MIC is valid, false otherwise or if the frame is too large.
+ */
+bool ezb_ccm_decrypt(const uint8_t *key, const uint8_t *nonce, const uint8_t *aad, size_t aad_len,
+                     const uint8_t *data, size_t data_len, const uint8_t *mic, uint8_t mic_len, uint8_t *plain);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
@@ -0,0 +1,49 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define EZB_FNV1A_OFFSET_BASIS 0x811c9dc5U
+#define EZB_FNV1A_PRIME        0x01000193U
+
+/* Fold the bytes of data into a 32-bit FNV-1a hash, start from EZB_FNV1A_OFFSET_BASIS. */
+static inline uint32_t ezb_fnv1a_update(uint32_t hash, const void *data, size_t len)
+{
+    const uint8_t *p = (const uint8_t *)data;
+
+    while (len--) {
+        hash ^= *p++;
+        hash *= EZB_FNV1A_PRIME;
+    }
+    return hash;
+}
+
+/* Multiplicative hashing by 2^64 / phi and 2^32 / phi, the high bits of the product are the best mixed ones. */
+#define EZB_HASH_GOLDEN_RATIO_64 0x9E3779B97F4A7C15ULL
+#define EZB_HASH_GOLDEN_RATIO_32 0x9E3779B9U
+
+/* Mix a 64-bit key into 32 bits, take the high bits of the result for a smaller range. */
+static inline uint32_t ezb_hash_mix64(uint64_t key)
+{
+    return (uint32_t)((key * EZB_HASH_GOLDEN_RATIO_64) >> 32);
+}
+
+/* Mix a 32-bit key, take the high bits of the result for a smaller range. */
+static inline uint32_t ezb_hash_mix32(uint32_t key)
+{
+    return key * EZB_HASH_GOLDEN_RATIO_32;
+}
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
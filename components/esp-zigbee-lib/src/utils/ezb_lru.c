@@ -0,0 +1,30 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <string.h>
+
+#include "utils/ezb_lru.h"
+
+void *ezb_lru_select(void *entries, size_t count, size_t size, size_t stamp_offset, ezb_lru_is_free_t is_free)
+{
+    uint8_t *victim = NULL;
+    uint32_t victim_stamp = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        uint8_t *entry = (uint8_t *)entries + i * size;
+        uint32_t stamp;
+
+        if (is_free(entry)) {
+            return entry;
+        }
+        memcpy(&stamp, entry + stamp_offset, sizeof(stamp));
+        if (!victim || (int32_t)(stamp - victim_stamp) < 0) {
+            victim = entry;
+            victim_stamp = stamp;
+        }
+    }
+    return victim;
+}
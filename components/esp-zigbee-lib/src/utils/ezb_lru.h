@@ -0,0 +1,38 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Return true if the entry is free. */
+typedef bool (*ezb_lru_is_free_t)(const void *entry);
+
+/**
+ * @brief Select the entry to replace in a fixed size table, a free entry or the least recently used one.
+ *
+ * The time of last use of an entry is the uint32_t at @p stamp_offset, a time in milliseconds or a counter,
+ * compared modulo 2^32.
+ *
+ * @param[in] entries      The table.
+ * @param[in] count        The number of entries, not zero.
+ * @param[in] size         The size of an entry.
+ * @param[in] stamp_offset The offset of the time of last use in an entry, see offsetof().
+ * @param[in] is_free      Tell whether an entry is free.
+ *
+ * @return The first free entry, the least recently used one if there is none.
+ */
+void *ezb_lru_select(void *entries, size_t count, size_t size, size_t stamp_offset, ezb_lru_is_free_t is_free);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
@@ -0,0 +1,35 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <ezbee/mac.h>
+#include <ezbee/nwk.h>
+#include <ezbee/aps.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief The counters of all the layers, in one structure so that updating and reading them stays cheap.
+ */
+typedef struct ezb_stats_s {
+    ezb_mac_stats_t mac;
+    ezb_nwk_stats_t nwk;
+    ezb_aps_stats_t aps;
+} ezb_stats_t;
+
+extern ezb_stats_t g_ezb_stats;
+
+#define EZB_STATS_INC(field) (g_ezb_stats.field++)
+
+/* Whether the NWK counters are enabled, for the counters updated outside of the NWK statistics module. */
+bool ezb_nwk_stats_is_enabled(void);
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
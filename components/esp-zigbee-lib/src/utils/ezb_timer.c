@@ -0,0 +1,85 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+
+#include "esp_zigbee.h"
+
+#include "utils/ezb_timer.h"
+
+/* Delay before posting an expiry again when the Zigbee task queue is full, in milliseconds */
+#define EZB_TIMER_POST_RETRY_MS 10U
+
+static void timer_expired_in_zigbee_task(void *ctx)
+{
+    ezb_timer_t *timer = (ezb_timer_t *)ctx;
+
+    /* The timer may have been stopped or restarted after the expiry was posted. */
+    if (!timer->armed || esp_timer_get_time() < timer->deadline) {
+        return;
+    }
+    timer->armed = false;
+    timer->cb(timer->ctx);
+}
+
+static void timer_expired(void *ctx)
+{
+    ezb_timer_t *timer = (ezb_timer_t *)ctx;
+
+    /* A lost expiry would leave the timer armed forever, and its owner would never start it again. */
+    if (esp_zigbee_task_queue_post(timer_expired_in_zigbee_task, ctx) != ESP_OK && timer->armed) {
+        esp_timer_start_once(timer->handle, (uint64_t)EZB_TIMER_POST_RETRY_MS * 1000);
+    }
+}
+
+bool ezb_timer_init(ezb_timer_t *timer, const char *name, void (*cb)(void *ctx), void *ctx)
+{
+    const esp_timer_create_args_t args = {
+        .callback = timer_expired,
+        .arg = timer,
+        .name = name,
+    };
+
+    timer->cb = cb;
+    timer->ctx = ctx;
+    timer->armed = false;
+    return esp_timer_create(&args, &timer->handle) == ESP_OK;
+}
+
+void ezb_timer_deinit(ezb_timer_t *timer)
+{
+    if (timer->handle) {
+        esp_timer_stop(timer->handle);
+        esp_timer_delete(timer->handle);
+        timer->handle = NULL;
+    }
+    timer->armed = false;
+}
+
+void ezb_timer_start(ezb_timer_t *timer, uint32_t delay_ms)
+{
+    esp_timer_stop(timer->handle);
+    timer->deadline = esp_timer_get_time() + (int64_t)delay_ms * 1000;
+    timer->armed = true;
+    esp_timer_start_once(timer->handle, (uint64_t)delay_ms * 1000);
+}
+
+void ezb_timer_stop(ezb_timer_t *timer)
+{
+    esp_timer_stop(timer->handle);
+    timer->armed = false;
+}
+
+uint32_t ezb_timer_get_remaining(const ezb_timer_t *timer)
+{
+    int64_t remaining;
+
+    if (!timer->armed) {
+        return UINT32_MAX;
+    }
+    remaining = timer->deadline - esp_timer_get_time();
+    return remaining > 0 ? (uint32_t)(remaining / 1000) : 0;
+}
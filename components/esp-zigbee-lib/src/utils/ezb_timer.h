@@ -0,0 +1,50 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "esp_timer.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief One-shot timer whose callback runs in the Zigbee task context.
+ *
+ * The expiry is posted to the Zigbee task queue, so the callback may call the stack APIs directly. The timer object
+ * must stay valid while an expiry may be queued, use static storage for it.
+ */
+typedef struct ezb_timer_s {
+    esp_timer_handle_t handle;
+    void (*cb)(void *ctx);
+    void *ctx;
+    int64_t deadline;   /* Absolute expiry time in microseconds */
+    bool armed;
+} ezb_timer_t;
+
+bool ezb_timer_init(ezb_timer_t *timer, const char *name, void (*cb)(void *ctx), void *ctx);
+
+void ezb_timer_deinit(ezb_timer_t *timer);
+
+void ezb_timer_start(ezb_timer_t *timer, uint32_t delay_ms);
+
+void ezb_timer_stop(ezb_timer_t *timer);
+
+/* Milliseconds until the expiry, UINT32_MAX if the timer is not armed. */
+uint32_t ezb_timer_get_remaining(const ezb_timer_t *timer);
+
+static inline bool ezb_timer_is_armed(const ezb_timer_t *timer)
+{
+    return timer->armed;
+}
+
+#ifdef __cplusplus
+} /*  extern "C" */
+#endif
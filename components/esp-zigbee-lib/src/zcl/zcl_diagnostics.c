@@ -0,0 +1,72 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <ezbee/zcl.h>
+
+#include "utils/ezb_stats.h"
+
+static bool diagnostics_set_counter(uint8_t ep_id, uint16_t attr_id, uint32_t value)
+{
+    ezb_zcl_attr_desc_t attr = ezb_zcl_get_attr_desc(ep_id, EZB_ZCL_CLUSTER_ID_DIAGNOSTICS, EZB_ZCL_CLUSTER_SERVER,
+                                                     attr_id, EZB_ZCL_STD_MANUF_CODE);
+    uint16_t u16 = value > UINT16_MAX ? UINT16_MAX : (uint16_t)value;
+
+    if (attr == EZB_INVALID_ZCL_ATTR_DESC) {
+        return false;
+    }
+    switch (ezb_zcl_attr_desc_get_value_size(attr)) {
+    case sizeof(uint32_t):
+        return ezb_zcl_attr_desc_set_value(attr, &value) == EZB_ERR_NONE;
+    case sizeof(uint16_t):
+        return ezb_zcl_attr_desc_set_value(attr, &u16) == EZB_ERR_NONE;
+    default:
+        return false;
+    }
+}
+
+static bool diagnostics_set_u8(uint8_t ep_id, uint16_t attr_id, const void *value)
+{
+    ezb_zcl_attr_desc_t attr = ezb_zcl_get_attr_desc(ep_id, EZB_ZCL_CLUSTER_ID_DIAGNOSTICS, EZB_ZCL_CLUSTER_SERVER,
+                                                     attr_id, EZB_ZCL_STD_MANUF_CODE);
+
+    return attr != EZB_INVALID_ZCL_ATTR_DESC && ezb_zcl_attr_desc_get_value_size(attr) == sizeof(uint8_t) &&
+           ezb_zcl_attr_desc_set_value(attr, value) == EZB_ERR_NONE;
+}
+
+ezb_err_t ezb_zcl_diagnostics_update_counters(uint8_t ep_id)
+{
+    const ezb_stats_t *stats = &g_ezb_stats;
+    const struct {
+        uint16_t attr_id;
+        uint32_t value;
+    } counters[] = {
+        {EZB_ZCL_ATTR_DIAGNOSTICS_MAC_RX_BCAST_ID,                    stats->mac.rx_bcast},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_MAC_TX_BCAST_ID,                    stats->mac.tx_bcast},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_MAC_RX_UCAST_ID,                    stats->mac.rx_ucast},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_MAC_TX_UCAST_ID,                    stats->mac.tx_ucast},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_MAC_TX_UCAST_RETRY_ID,              stats->mac.tx_ucast_retry},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_MAC_TX_UCAST_FAIL_ID,               stats->mac.tx_ucast_fail},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_APS_RX_BCAST_ID,                    stats->aps.rx_bcast},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_APS_RX_UCAST_ID,                    stats->aps.rx_ucast},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_APS_TX_UCAST_SUCCESS_ID,            stats->aps.tx_ucast_success},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_APS_TX_UCAST_FAIL_ID,               stats->aps.tx_ucast_fail},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_NWK_FC_FAILURE_ID,                  stats->nwk.frame_counter_failures},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_NWK_DECRYPT_FAILURES_ID,            stats->nwk.decrypt_failures},
+        {EZB_ZCL_ATTR_DIAGNOSTICS_RELAYED_UCAST_ID,                   stats->nwk.relayed_ucast},
+    };
+    bool updated = false;
+
+    for (size_t i = 0; i < sizeof(counters) / sizeof(counters[0]); i++) {
+        updated |= diagnostics_set_counter(ep_id, counters[i].attr_id, counters[i].value);
+    }
+    updated |= diagnostics_set_u8(ep_id, EZB_ZCL_ATTR_DIAGNOSTICS_LAST_LQI_ID, &stats->mac.last_lqi);
+    updated |= diagnostics_set_u8(ep_id, EZB_ZCL_ATTR_DIAGNOSTICS_LAST_RSSI_ID, &stats->mac.last_rssi);
+
+    return updated ? EZB_ERR_NONE : EZB_ERR_NOT_FOUND;
+}
@@ -0,0 +1,315 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include <ezbee/nwk.h>
+#include <ezbee/zdo/zdo_type.h>
+#include <ezbee/aps/aps_binding.h>
+
+#include "aps/aps_binding_zdp.h"
+
+#define TEST_SRC_ENDPOINT 0x01U
+#define TEST_DST_ENDPOINT 0x0AU
+#define TEST_CLUSTER_ID   0x0006U
+#define TEST_GROUP_ID     0x1234U
+
+static const ezb_extaddr_t s_remote_addr = {.u8 = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08}};
+
+/* A Bind_req or Unbind_req as received over the air: transaction sequence number, source address, source endpoint,
+ * cluster, destination address mode, then the group address or the extended address and endpoint. */
+static uint16_t test_zdp_bind_req(uint8_t *asdu, const ezb_extaddr_t *src_addr, uint8_t dst_addr_mode)
+{
+    uint16_t length = 0;
+
+    asdu[length++] = 0x42;
+    memcpy(asdu + length, src_addr->u8, 8);
+    length += 8;
+    asdu[length++] = TEST_SRC_ENDPOINT;
+    asdu[length++] = TEST_CLUSTER_ID & 0xff;
+    asdu[length++] = TEST_CLUSTER_ID >> 8;
+    asdu[length++] = dst_addr_mode;
+    if (dst_addr_mode == 0x01) {
+        asdu[length++] = TEST_GROUP_ID & 0xff;
+        asdu[length++] = TEST_GROUP_ID >> 8;
+    } else {
+        memcpy(asdu + length, s_remote_addr.u8, 8);
+        length += 8;
+        asdu[length++] = TEST_DST_ENDPOINT;
+    }
+    return length;
+}
+
+static void test_zdp_indication(ezb_apsde_data_ind_t *ind, uint16_t cluster_id, uint8_t *asdu, uint16_t length)
+{
+    memset(ind, 0, sizeof(ezb_apsde_data_ind_t));
+    ind->src_address.addr_mode = EZB_ADDR_MODE_SHORT;
+    ind->src_address.u.short_addr = 0x0000;
+    ind->cluster_id = cluster_id;
+    ind->asdu = asdu;
+    ind->asdu_length = length;
+}
+
+TEST_CASE("Bind_req to a group is decoded", "[aps_binding]")
+{
+    uint8_t asdu[32];
+    ezb_extaddr_t local_addr;
+    ezb_apsde_data_ind_t ind;
+    ezb_aps_binding_t binding;
+
+    ezb_nwk_get_extended_address(&local_addr);
+    test_zdp_indication(&ind, EZB_ZDO_CMD_BIND_REQ, asdu, test_zdp_bind_req(asdu, &local_addr, 0x01));
+    TEST_ASSERT_EQUAL(15, ind.asdu_length);
+    TEST_ASSERT_TRUE(ezb_aps_binding_zdp_parse(&ind, &binding));
+    TEST_ASSERT_EQUAL(TEST_SRC_ENDPOINT, binding.src_endpoint);
+    TEST_ASSERT_EQUAL_HEX16(TEST_CLUSTER_ID, binding.cluster_id);
+    TEST_ASSERT_EQUAL(EZB_ADDR_MODE_GROUP, binding.dst_address.addr_mode);
+    TEST_ASSERT_EQUAL_HEX16(TEST_GROUP_ID, binding.dst_address.u.group_addr.group);
+}
+
+TEST_CASE("Unbind_req to an extended address is decoded", "[aps_binding]")
+{
+    uint8_t asdu[32];
+    ezb_extaddr_t local_addr;
+    ezb_apsde_data_ind_t ind;
+    ezb_aps_binding_t binding;
+
+    ezb_nwk_get_extended_address(&local_addr);
+    test_zdp_indication(&ind, EZB_ZDO_CMD_UNBIND_REQ, asdu, test_zdp_bind_req(asdu, &local_addr, 0x03));
+    TEST_ASSERT_EQUAL(22, ind.asdu_length);
+    TEST_ASSERT_TRUE(ezb_aps_binding_zdp_parse(&ind, &binding));
+    TEST_ASSERT_EQUAL(EZB_ADDR_MODE_EXT, binding.dst_address.addr_mode);
+    TEST_ASSERT_EQUAL_HEX8_ARRAY(s_remote_addr.u8, binding.dst_address.u.extended_addr.u8, 8);
+    TEST_ASSERT_EQUAL(TEST_DST_ENDPOINT, binding.dst_endpoint);
+}
+
+TEST_CASE("truncated Bind_req is rejected", "[aps_binding]")
+{
+    uint8_t asdu[32];
+    ezb_extaddr_t local_addr;
+    ezb_apsde_data_ind_t ind;
+    ezb_aps_binding_t binding;
+
+    ezb_nwk_get_extended_address(&local_addr);
+    test_zdp_indication(&ind, EZB_ZDO_CMD_BIND_REQ, asdu, test_zdp_bind_req(asdu, &local_addr, 0x01));
+    ind.asdu_length = 12;
+    TEST_ASSERT_FALSE(ezb_aps_binding_zdp_parse(&ind, &binding));
+    ind.asdu_length = 14;
+    TEST_ASSERT_FALSE(ezb_aps_binding_zdp_parse(&ind, &binding));
+
+    test_zdp_indication(&ind, EZB_ZDO_CMD_BIND_REQ, asdu, test_zdp_bind_req(asdu, &local_addr, 0x03));
+    ind.asdu_length = 21;
+    TEST_ASSERT_FALSE(ezb_aps_binding_zdp_parse(&ind, &binding));
+}
+
+TEST_CASE("Bind_req of another device is ignored", "[aps_binding]")
+{
+    uint8_t asdu[32];
+    ezb_apsde_data_ind_t ind;
+    ezb_aps_binding_t binding;
+
+    test_zdp_indication(&ind, EZB_ZDO_CMD_BIND_REQ, asdu, test_zdp_bind_req(asdu, &s_remote_addr, 0x01));
+    TEST_ASSERT_FALSE(ezb_aps_binding_zdp_parse(&ind, &binding));
+}
+
+static void test_group_binding(ezb_aps_binding_t *binding, uint8_t src_endpoint, uint16_t cluster_id, uint16_t group)
+{
+    memset(binding, 0, sizeof(ezb_aps_binding_t));
+    binding->src_endpoint = src_endpoint;
+    binding->cluster_id = cluster_id;
+    binding->dst_address.addr_mode = EZB_ADDR_MODE_GROUP;
+    binding->dst_address.u.group_addr.group = group;
+}
+
+static void test_index_init(uint16_t src_size, uint16_t dst_size)
+{
+    ezb_aps_binding_index_config_t config = {
+        .src_size = src_size,
+        .dst_size = dst_size,
+    };
+
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_index_init(&config));
+}
+
+/* The number of bindings of a pair found by the iteration, each one checked against the expected groups. */
+static uint16_t test_count_bindings(uint8_t src_endpoint, uint16_t cluster_id, const uint16_t *groups, uint16_t count)
+{
+    ezb_aps_binding_t binding;
+    uint16_t iter = 0;
+    uint16_t found = 0;
+    uint32_t seen = 0;
+
+    while (ezb_aps_binding_get_next(src_endpoint, cluster_id, &iter, &binding) == EZB_ERR_NONE) {
+        uint16_t i = 0;
+        TEST_ASSERT_EQUAL(src_endpoint, binding.src_endpoint);
+        TEST_ASSERT_EQUAL_HEX16(cluster_id, binding.cluster_id);
+        TEST_ASSERT_EQUAL(EZB_ADDR_MODE_GROUP, binding.dst_address.addr_mode);
+        while (i < count && groups[i] != binding.dst_address.u.group_addr.group) {
+            i++;
+        }
+        TEST_ASSERT_LESS_THAN(count, i);
+        TEST_ASSERT_FALSE(seen & (1U << i));
+        seen |= 1U << i;
+        found++;
+    }
+    return found;
+}
+
+TEST_CASE("pairs added out of order are all found", "[aps_binding]")
+{
+    static const uint8_t endpoints[] = {5, 1, 3, 1, 2, 5, 4};
+    static const uint16_t clusters[] = {0x0006, 0x0300, 0x0008, 0x0006, 0x0006, 0x0001, 0x0006};
+    ezb_aps_binding_t binding;
+    ezb_aps_binding_index_stats_t stats;
+    uint16_t group;
+
+    test_index_init(8, 8);
+    for (uint8_t i = 0; i < sizeof(endpoints); i++) {
+        test_group_binding(&binding, endpoints[i], clusters[i], TEST_GROUP_ID + i);
+        TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_add_batch(&binding, 1, NULL));
+    }
+    ezb_aps_binding_index_get_stats(&stats);
+    TEST_ASSERT_EQUAL(sizeof(endpoints), stats.src_used);
+    TEST_ASSERT_EQUAL(sizeof(endpoints), stats.dst_used);
+
+    for (uint8_t i = 0; i < sizeof(endpoints); i++) {
+        group = TEST_GROUP_ID + i;
+        TEST_ASSERT_EQUAL(1, test_count_bindings(endpoints[i], clusters[i], &group, 1));
+    }
+    TEST_ASSERT_EQUAL(0, test_count_bindings(1, 0x0008, NULL, 0));
+    TEST_ASSERT_EQUAL(0, test_count_bindings(6, 0x0006, NULL, 0));
+    ezb_aps_binding_index_deinit();
+}
+
+TEST_CASE("bindings already present are skipped", "[aps_binding]")
+{
+    ezb_aps_binding_t bindings[2];
+    ezb_aps_binding_index_stats_t stats;
+    uint16_t added;
+
+    test_index_init(4, 4);
+    test_group_binding(&bindings[0], TEST_SRC_ENDPOINT, TEST_CLUSTER_ID, TEST_GROUP_ID);
+    bindings[1] = bindings[0];
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_add_batch(bindings, 2, &added));
+    TEST_ASSERT_EQUAL(2, added);
+    ezb_aps_binding_index_get_stats(&stats);
+    TEST_ASSERT_EQUAL(1, stats.src_used);
+    TEST_ASSERT_EQUAL(1, stats.dst_used);
+    ezb_aps_binding_index_deinit();
+}
+
+TEST_CASE("removing the last destination of a pair removes the pair", "[aps_binding]")
+{
+    static const uint16_t groups[] = {TEST_GROUP_ID, TEST_GROUP_ID + 1, TEST_GROUP_ID + 2};
+    ezb_aps_binding_t bindings[3];
+    ezb_aps_binding_t other;
+    ezb_aps_binding_index_stats_t stats;
+
+    test_index_init(4, 4);
+    for (uint8_t i = 0; i < 3; i++) {
+        test_group_binding(&bindings[i], TEST_SRC_ENDPOINT, TEST_CLUSTER_ID, groups[i]);
+    }
+    test_group_binding(&other, TEST_SRC_ENDPOINT + 1, TEST_CLUSTER_ID, TEST_GROUP_ID);
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_add_batch(bindings, 3, NULL));
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_add_batch(&other, 1, NULL));
+
+    /* Remove the destination in the middle of the list, then one absent. */
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_remove_batch(&bindings[1], 1));
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_remove_batch(&bindings[1], 1));
+    ezb_aps_binding_index_get_stats(&stats);
+    TEST_ASSERT_EQUAL(2, stats.src_used);
+    TEST_ASSERT_EQUAL(3, stats.dst_used);
+    TEST_ASSERT_EQUAL(2, test_count_bindings(TEST_SRC_ENDPOINT, TEST_CLUSTER_ID, groups, 3));
+
+    bindings[1] = bindings[2];
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_remove_batch(bindings, 2));
+    ezb_aps_binding_index_get_stats(&stats);
+    TEST_ASSERT_EQUAL(1, stats.src_used);
+    TEST_ASSERT_EQUAL(1, stats.dst_used);
+    TEST_ASSERT_EQUAL(0, test_count_bindings(TEST_SRC_ENDPOINT, TEST_CLUSTER_ID, NULL, 0));
+    TEST_ASSERT_EQUAL(1, test_count_bindings(TEST_SRC_ENDPOINT + 1, TEST_CLUSTER_ID, groups, 1));
+    ezb_aps_binding_index_deinit();
+}
+
+TEST_CASE("removed destinations are reused", "[aps_binding]")
+{
+    ezb_aps_binding_t bindings[3];
+    ezb_aps_binding_index_stats_t stats;
+
+    test_index_init(4, 2);
+    for (uint8_t i = 0; i < 3; i++) {
+        test_group_binding(&bindings[i], TEST_SRC_ENDPOINT + i, TEST_CLUSTER_ID, TEST_GROUP_ID);
+    }
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_add_batch(bindings, 2, NULL));
+    TEST_ASSERT_EQUAL(EZB_ERR_NO_MEM, ezb_aps_binding_add_batch(&bindings[2], 1, NULL));
+
+    for (uint8_t round = 0; round < 4; round++) {
+        TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_remove_batch(&bindings[round % 2], 1));
+        TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_add_batch(&bindings[2], 1, NULL));
+        TEST_ASSERT_EQUAL(EZB_ERR_NO_MEM, ezb_aps_binding_add_batch(&bindings[round % 2], 1, NULL));
+        TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_remove_batch(&bindings[2], 1));
+        TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_add_batch(&bindings[round % 2], 1, NULL));
+    }
+    ezb_aps_binding_index_get_stats(&stats);
+    TEST_ASSERT_EQUAL(2, stats.src_used);
+    TEST_ASSERT_EQUAL(2, stats.dst_used);
+    ezb_aps_binding_index_deinit();
+}
+
+TEST_CASE("batch add reports the bindings added before an error", "[aps_binding]")
+{
+    ezb_aps_binding_t bindings[3];
+    ezb_aps_binding_index_stats_t stats;
+    uint16_t added = 0;
+
+    test_index_init(4, 2);
+    for (uint8_t i = 0; i < 3; i++) {
+        test_group_binding(&bindings[i], TEST_SRC_ENDPOINT, TEST_CLUSTER_ID, TEST_GROUP_ID + i);
+    }
+    TEST_ASSERT_EQUAL(EZB_ERR_NO_MEM, ezb_aps_binding_add_batch(bindings, 3, &added));
+    TEST_ASSERT_EQUAL(2, added);
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_remove_batch(bindings, 2));
+
+    bindings[1].dst_address.addr_mode = EZB_ADDR_MODE_SHORT;
+    TEST_ASSERT_EQUAL(EZB_ERR_INV_ARG, ezb_aps_binding_add_batch(bindings, 3, &added));
+    TEST_ASSERT_EQUAL(1, added);
+    ezb_aps_binding_index_get_stats(&stats);
+    TEST_ASSERT_EQUAL(1, stats.dst_used);
+    ezb_aps_binding_index_deinit();
+}
+
+TEST_CASE("iteration returns each destination once then ends", "[aps_binding]")
+{
+    static const uint16_t groups[] = {TEST_GROUP_ID, TEST_GROUP_ID + 1, TEST_GROUP_ID + 2};
+    ezb_aps_binding_t bindings[4];
+    ezb_aps_binding_t binding;
+    uint16_t iter = 0;
+
+    test_index_init(4, 4);
+    for (uint8_t i = 0; i < 3; i++) {
+        test_group_binding(&bindings[i], TEST_SRC_ENDPOINT, TEST_CLUSTER_ID, groups[i]);
+    }
+    bindings[3] = bindings[0];
+    bindings[3].dst_address.addr_mode = EZB_ADDR_MODE_EXT;
+    bindings[3].dst_address.u.extended_addr = s_remote_addr;
+    bindings[3].dst_endpoint = TEST_DST_ENDPOINT;
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_add_batch(bindings, 3, NULL));
+    TEST_ASSERT_EQUAL(3, test_count_bindings(TEST_SRC_ENDPOINT, TEST_CLUSTER_ID, groups, 3));
+
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_add_batch(&bindings[3], 1, NULL));
+    for (uint8_t i = 0; i < 4; i++) {
+        TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_get_next(TEST_SRC_ENDPOINT, TEST_CLUSTER_ID, &iter, &binding));
+        if (binding.dst_address.addr_mode == EZB_ADDR_MODE_EXT) {
+            TEST_ASSERT_EQUAL_HEX8_ARRAY(s_remote_addr.u8, binding.dst_address.u.extended_addr.u8, 8);
+            TEST_ASSERT_EQUAL(TEST_DST_ENDPOINT, binding.dst_endpoint);
+        }
+    }
+    TEST_ASSERT_EQUAL(EZB_ERR_NOT_FOUND, ezb_aps_binding_get_next(TEST_SRC_ENDPOINT, TEST_CLUSTER_ID, &iter, &binding));
+    TEST_ASSERT_EQUAL(EZB_ERR_NOT_FOUND, ezb_aps_binding_get_next(TEST_SRC_ENDPOINT, TEST_CLUSTER_ID, &iter, &binding));
+    ezb_aps_binding_index_deinit();
+}
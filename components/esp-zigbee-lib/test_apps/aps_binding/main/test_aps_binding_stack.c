@@ -0,0 +1,258 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include <string.h>
+
+#include "unity.h"
+
+#include "esp_zigbee.h"
+
+#include "aps/aps_hook.h"
+
+#include "test_zigbee.h"
+
+#define TEST_CLUSTER_ID   0x0006U
+#define TEST_GROUP_ID     0x2345U
+#define TEST_WAIT_TIMEOUT 5000U
+
+typedef struct test_bind_result_s {
+    bool done;
+    ezb_err_t error;
+    uint8_t status;
+} test_bind_result_t;
+
+static uint16_t s_requests;
+static uint16_t s_request_groups[4];
+
+static bool test_bind_done(void *ctx)
+{
+    return ((test_bind_result_t *)ctx)->done;
+}
+
+static void test_mgmt_bind_cb(const ezb_zdo_nwk_mgmt_bind_req_result_t *result, void *user_ctx)
+{
+    test_bind_result_t *bind_result = user_ctx;
+
+    bind_result->error = result->error;
+    bind_result->status = result->rsp ? result->rsp->status : 0xFF;
+    bind_result->done = true;
+}
+
+static void test_bind_cb(const ezb_zdp_bind_req_result_t *result, void *user_ctx)
+{
+    test_bind_result_t *bind_result = user_ctx;
+
+    bind_result->error = result->error;
+    bind_result->status = result->rsp ? result->rsp->status : 0xFF;
+    bind_result->done = true;
+}
+
+/* Bind or unbind a group in the binding table of the stack, with a ZDO request to this device. */
+static void test_stack_bind(bool bind, uint16_t group)
+{
+    test_bind_result_t result = {0};
+    ezb_zdo_bind_req_t req = {
+        .field = {
+            .src_ep = TEST_ZIGBEE_ENDPOINT,
+            .cluster_id = TEST_CLUSTER_ID,
+            .dst_addr_mode = EZB_ADDR_MODE_GROUP,
+            .dst_addr.group_addr.group = group,
+        },
+        .cb = test_bind_cb,
+        .user_ctx = &result,
+    };
+
+    esp_zigbee_lock_acquire(portMAX_DELAY);
+    req.dst_nwk_addr = ezb_nwk_get_short_address();
+    ezb_nwk_get_extended_address(&req.field.src_addr);
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, bind ? ezb_zdo_bind_req(&req) : ezb_zdo_unbind_req(&req));
+    esp_zigbee_lock_release();
+    TEST_ASSERT_TRUE(test_zigbee_wait(test_bind_done, &result, TEST_WAIT_TIMEOUT));
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, result.error);
+}
+
+static bool test_group_is_indexed(void *ctx)
+{
+    ezb_aps_binding_t binding;
+    uint16_t iter = 0;
+
+    while (ezb_aps_binding_get_next(TEST_ZIGBEE_ENDPOINT, TEST_CLUSTER_ID, &iter, &binding) == EZB_ERR_NONE) {
+        if (binding.dst_address.addr_mode == EZB_ADDR_MODE_GROUP &&
+            binding.dst_address.u.group_addr.group == *(uint16_t *)ctx) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static bool test_group_is_not_indexed(void *ctx)
+{
+    return !test_group_is_indexed(ctx);
+}
+
+static bool test_index_synced(void *ctx)
+{
+    ezb_aps_binding_index_stats_t stats;
+
+    ezb_aps_binding_index_get_stats(&stats);
+    return stats.syncs >= *(uint32_t *)ctx;
+}
+
+static void test_index_init(bool mirror_zdo)
+{
+    ezb_aps_binding_index_config_t config = {
+        .src_size = 4,
+        .dst_size = 4,
+        .mirror_zdo = mirror_zdo,
+    };
+
+    esp_zigbee_lock_acquire(portMAX_DELAY);
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_index_init(&config));
+    esp_zigbee_lock_release();
+}
+
+static void test_index_deinit(void)
+{
+    esp_zigbee_lock_acquire(portMAX_DELAY);
+    ezb_aps_binding_index_deinit();
+    esp_zigbee_lock_release();
+}
+
+TEST_CASE("Mgmt_Bind_req sent to this device is answered by its stack", "[aps_binding]")
+{
+    test_bind_result_t result = {0};
+    ezb_zdo_nwk_mgmt_bind_req_t req = {
+        .field.start_index = 0,
+        .cb = test_mgmt_bind_cb,
+        .user_ctx = &result,
+    };
+
+    test_zigbee_start();
+    esp_zigbee_lock_acquire(portMAX_DELAY);
+    req.dst_nwk_addr = ezb_nwk_get_short_address();
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_zdo_nwk_mgmt_bind_req(&req));
+    esp_zigbee_lock_release();
+    TEST_ASSERT_TRUE(test_zigbee_wait(test_bind_done, &result, TEST_WAIT_TIMEOUT));
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, result.error);
+    TEST_ASSERT_EQUAL(EZB_ZDP_STATUS_SUCCESS, result.status);
+}
+
+TEST_CASE("bindings of the stack are mirrored at initialization", "[aps_binding]")
+{
+    uint16_t group = TEST_GROUP_ID;
+    uint32_t syncs = 1;
+
+    test_zigbee_start();
+    test_stack_bind(true, group);
+    test_index_init(true);
+    TEST_ASSERT_TRUE(test_zigbee_wait(test_index_synced, &syncs, TEST_WAIT_TIMEOUT));
+    TEST_ASSERT_TRUE(test_zigbee_wait(test_group_is_indexed, &group, 0));
+    test_index_deinit();
+    test_stack_bind(false, group);
+}
+
+TEST_CASE("Bind_req is mirrored only once the stack has accepted it", "[aps_binding]")
+{
+    uint8_t asdu[] = {0x42, 0, 0, 0, 0, 0, 0, 0, 0, TEST_ZIGBEE_ENDPOINT, TEST_CLUSTER_ID & 0xff, TEST_CLUSTER_ID >> 8,
+                      0x01, 0, 0};
+    ezb_apsde_data_ind_t ind = {
+        .src_address.addr_mode = EZB_ADDR_MODE_SHORT,
+        .cluster_id = EZB_ZDO_CMD_BIND_REQ,
+        .asdu = asdu,
+        .asdu_length = sizeof(asdu),
+    };
+    uint16_t accepted = TEST_GROUP_ID + 1;
+    uint16_t refused = TEST_GROUP_ID + 2;
+    uint32_t syncs = 1;
+    ezb_extaddr_t local_addr;
+
+    test_zigbee_start();
+    test_index_init(true);
+    TEST_ASSERT_TRUE(test_zigbee_wait(test_index_synced, &syncs, TEST_WAIT_TIMEOUT));
+
+    /* A Bind_req the stack has not applied is not mirrored. */
+    esp_zigbee_lock_acquire(portMAX_DELAY);
+    ezb_nwk_get_extended_address(&local_addr);
+    memcpy(asdu + 1, local_addr.u8, sizeof(local_addr.u8));
+    asdu[13] = refused & 0xff;
+    asdu[14] = refused >> 8;
+    TEST_ASSERT_FALSE(ezb_aps_hook_dispatch_indication(NULL, &ind));
+    esp_zigbee_lock_release();
+    TEST_ASSERT_FALSE(test_zigbee_wait(test_group_is_indexed, &refused, 1000));
+
+    /* The stack has the binding of this one. */
+    test_stack_bind(true, accepted);
+    esp_zigbee_lock_acquire(portMAX_DELAY);
+    asdu[13] = accepted & 0xff;
+    asdu[14] = accepted >> 8;
+    TEST_ASSERT_FALSE(ezb_aps_hook_dispatch_indication(NULL, &ind));
+    esp_zigbee_lock_release();
+    TEST_ASSERT_TRUE(test_zigbee_wait(test_group_is_indexed, &accepted, TEST_WAIT_TIMEOUT));
+
+    /* And the Unbind_req once the stack has removed it. */
+    test_stack_bind(false, accepted);
+    esp_zigbee_lock_acquire(portMAX_DELAY);
+    ind.cluster_id = EZB_ZDO_CMD_UNBIND_REQ;
+    TEST_ASSERT_FALSE(ezb_aps_hook_dispatch_indication(NULL, &ind));
+    esp_zigbee_lock_release();
+    TEST_ASSERT_TRUE(test_zigbee_wait(test_group_is_not_indexed, &accepted, TEST_WAIT_TIMEOUT));
+    test_index_deinit();
+}
+
+static void test_fan_out_request(const ezb_apsde_data_req_t *req, ezb_err_t ret)
+{
+    if (ret == EZB_ERR_NONE && s_requests < sizeof(s_request_groups) / sizeof(s_request_groups[0]) &&
+        req->dst_address.addr_mode == EZB_ADDR_MODE_GROUP) {
+        s_request_groups[s_requests++] = req->dst_address.u.group_addr.group;
+    }
+}
+
+TEST_CASE("a request is issued to each binding of its pair", "[aps_binding]")
+{
+    static ezb_aps_hook_t hook = {
+        .request = test_fan_out_request,
+    };
+    uint8_t asdu[] = {0x01, 0x00, 0x02};   /* ZCL cluster specific Toggle */
+    ezb_apsde_data_req_t req = {
+        .src_endpoint = TEST_ZIGBEE_ENDPOINT,
+        .cluster_id = TEST_CLUSTER_ID,
+        .profile_id = EZB_AF_HA_PROFILE_ID,
+        .asdu = asdu,
+        .asdu_length = sizeof(asdu),
+    };
+    ezb_aps_binding_t bindings[3] = {0};
+    uint16_t sent = 0;
+    uint16_t seen = 0;
+
+    test_zigbee_start();
+    test_index_init(false);
+    for (uint8_t i = 0; i < 3; i++) {
+        bindings[i].src_endpoint = i < 2 ? TEST_ZIGBEE_ENDPOINT : TEST_ZIGBEE_ENDPOINT + 1;
+        bindings[i].cluster_id = TEST_CLUSTER_ID;
+        bindings[i].dst_address.addr_mode = EZB_ADDR_MODE_GROUP;
+        bindings[i].dst_address.u.group_addr.group = TEST_GROUP_ID + i;
+    }
+
+    esp_zigbee_lock_acquire(portMAX_DELAY);
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_add_batch(bindings, 3, NULL));
+    s_requests = 0;
+    ezb_aps_hook_register(&hook);
+    TEST_ASSERT_EQUAL(EZB_ERR_NONE, ezb_aps_binding_data_request(&req, &sent));
+    ezb_aps_hook_unregister(&hook);
+    req.cluster_id = TEST_CLUSTER_ID + 1;
+    TEST_ASSERT_EQUAL(EZB_ERR_NOT_FOUND, ezb_aps_binding_data_request(&req, NULL));
+    esp_zigbee_lock_release();
+
+    /* Only the two destinations of the source endpoint, each once. */
+    TEST_ASSERT_EQUAL(2, sent);
+    TEST_ASSERT_EQUAL(2, s_requests);
+    for (uint8_t i = 0; i < s_requests; i++) {
+        TEST_ASSERT_TRUE(s_request_groups[i] == TEST_GROUP_ID || s_request_groups[i] == TEST_GROUP_ID + 1);
+        seen |= 1U << (s_request_groups[i] - TEST_GROUP_ID);
+    }
+    TEST_ASSERT_EQUAL(0x3, seen);
+    test_index_deinit();
+}
@@ -0,0 +1,114 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/task.h"
+#include "nvs_flash.h"
+#include "unity.h"
+
+#include "esp_zigbee.h"
+#include "ezbee/zha.h"
+
+#include "test_zigbee.h"
+
+#define TEST_ZIGBEE_STORAGE_PARTITION_NAME "zb_storage"
+#define TEST_ZIGBEE_CHANNEL_MASK           (1U << 13)
+#define TEST_ZIGBEE_START_TIMEOUT          30000U
+
+static SemaphoreHandle_t s_started;
+
+static bool test_zigbee_signal_handler(const ezb_app_signal_t *app_signal)
+{
+    ezb_app_signal_type_t type = ezb_app_signal_get_type(app_signal);
+    ezb_bdb_comm_status_t status;
+
+    switch (type) {
+    case EZB_ZDO_SIGNAL_SKIP_STARTUP:
+        ezb_bdb_start_top_level_commissioning(EZB_BDB_MODE_INITIALIZATION);
+        break;
+    case EZB_BDB_SIGNAL_DEVICE_FIRST_START:
+    case EZB_BDB_SIGNAL_DEVICE_REBOOT:
+        status = *((ezb_bdb_comm_status_t *)ezb_app_signal_get_params(app_signal));
+        if (status == EZB_BDB_STATUS_SUCCESS && ezb_bdb_is_factory_new()) {
+            ezb_bdb_start_top_level_commissioning(EZB_BDB_MODE_NETWORK_FORMATION);
+        } else if (status == EZB_BDB_STATUS_SUCCESS) {
+            xSemaphoreGive(s_started);
+        }
+        break;
+    case EZB_BDB_SIGNAL_FORMATION:
+        status = *((ezb_bdb_comm_status_t *)ezb_app_signal_get_params(app_signal));
+        if (status == EZB_BDB_STATUS_SUCCESS) {
+            xSemaphoreGive(s_started);
+        }
+        break;
+    default:
+        break;
+    }
+    return false;
+}
+
+static void test_zigbee_task(void *arg)
+{
+    esp_zigbee_config_t config = {
+        .device_config = {
+            .device_type = EZB_NWK_DEVICE_TYPE_COORDINATOR,
+            .zczr_config = {
+                .max_children = 10,
+            },
+        },
+        .platform_config = {
+            .storage_partition_name = TEST_ZIGBEE_STORAGE_PARTITION_NAME,
+            .radio_config = {
+                .radio_mode = ESP_ZIGBEE_RADIO_MODE_NATIVE,
+            },
+        },
+    };
+    ezb_zha_on_off_light_config_t light_cfg = EZB_ZHA_ON_OFF_LIGHT_CONFIG();
+    ezb_af_device_desc_t dev_desc;
+
+    /* A failure leaves test_zigbee_start() waiting until its timeout, the assertions only hold in the test task. */
+    if (esp_zigbee_init(&config) != ESP_OK) {
+        vTaskDelete(NULL);
+    }
+    ezb_bdb_set_primary_channel_set(TEST_ZIGBEE_CHANNEL_MASK);
+    ezb_app_signal_add_handler(test_zigbee_signal_handler);
+    dev_desc = ezb_af_create_device_desc();
+    ezb_af_device_add_endpoint_desc(dev_desc, ezb_zha_create_on_off_light(TEST_ZIGBEE_ENDPOINT, &light_cfg));
+    ezb_af_device_desc_register(dev_desc);
+    if (esp_zigbee_start(false) == ESP_OK) {
+        esp_zigbee_launch_mainloop();
+    }
+    vTaskDelete(NULL);
+}
+
+void test_zigbee_start(void)
+{
+    if (s_started) {
+        return;
+    }
+    s_started = xSemaphoreCreateBinary();
+    TEST_ASSERT_NOT_NULL(s_started);
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_flash_init());
+    TEST_ASSERT_EQUAL(ESP_OK, nvs_flash_init_partition(TEST_ZIGBEE_STORAGE_PARTITION_NAME));
+    TEST_ASSERT_EQUAL(pdPASS, xTaskCreate(test_zigbee_task, "Zigbee_main", 4096, NULL, 5, NULL));
+    TEST_ASSERT_EQUAL(pdTRUE, xSemaphoreTake(s_started, pdMS_TO_TICKS(TEST_ZIGBEE_START_TIMEOUT)));
+}
+
+bool test_zigbee_wait(bool (*cond)(void *ctx), void *ctx, uint32_t timeout_ms)
+{
+    bool done = false;
+
+    for (uint32_t waited = 0; !done && waited <= timeout_ms; waited += 50) {
+        esp_zigbee_lock_acquire(portMAX_DELAY);
+        done = cond(ctx);
+        esp_zigbee_lock_release();
+        if (!done) {
+            vTaskDelay(pdMS_TO_TICKS(50));
+        }
+    }
+    return done;
+}
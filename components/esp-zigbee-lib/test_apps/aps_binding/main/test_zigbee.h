@@ -0,0 +1,19 @@
+/*
+ * SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+ *
+ * SPDX-License-Identifier: CC0-1.0
+ */
+
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define TEST_ZIGBEE_ENDPOINT 0x01U
+
+/* Start the stack as a coordinator on a network of its own, once for all the test cases, and wait until it is on the
+ * network. The stack APIs are then called with the Zigbee lock held. */
+void test_zigbee_start(void);
+
+/* Wait up to @p timeout_ms for @p cond to become true, checked with the Zigbee lock held. */
+bool test_zigbee_wait(bool (*cond)(void *ctx), void *ctx, uint32_t timeout_ms);
@@ -0,0 +1,11 @@
+# SPDX-FileCopyrightText: 2026 Espressif Systems (Shanghai) CO LTD
+# SPDX-License-Identifier: CC0-1.0
+
+import pytest
+from pytest_embedded_idf.dut import IdfDut
+
+
+@pytest.mark.esp32h2
+@pytest.mark.esp32c6
+def test_aps_binding(dut: IdfDut) -> None:
+    dut.run_all_single_board_cases(group='aps_binding')